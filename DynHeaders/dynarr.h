@@ -20,6 +20,10 @@
  * elements from an array with 60 elements, its capacity will remain unchanged). Use the functions present
  * in this library to decrease the amount of memory allocated to that array.
  * <br><br>
+ * The reductions of floating-point arrays ignore NaNs when looking for extremes: <u>DynarrArgMin()</u>,
+ * <u>DynarrArgMax()</u>, <u>DynarrMin()</u>, <u>DynarrMax()</u> and their view counterparts return the
+ * smallest or biggest element that isn't NaN, or the first element if all of them are NaN.
+ * <br><br>
  * Built with GCC 8.1.0 (x86_64-posix-seh-rev0) on Windows 10.
  */
 
@@ -27,6 +31,8 @@
 #define DYNARR_H
 
 #include <stdio.h>      /* printf, fprintf */
+#include <stddef.h>     /* size_t, ptrdiff_t, max_align_t */
+#include <stdint.h>     /* SIZE_MAX */
 #include <stdlib.h>     /* qsort, calloc, realloc, free */
 #include <string.h>     /* memcpy, memcmp, memmove */
 #include "dynvar.h"     /* All Dynvar functions */
@@ -45,6 +51,134 @@
     };
 #endif // _DYN_DTYPES
 
+#ifndef DYNARR_PARALLEL_THRESHOLD
+    /**
+     * Arrays with fewer elements than this are always sorted by a single thread, as the cost of
+     * splitting and merging them outweighs the gains. Define it before compiling the library to tune it.
+     */
+    #define DYNARR_PARALLEL_THRESHOLD 65536
+#endif // DYNARR_PARALLEL_THRESHOLD
+
+#ifndef DYNARR_PARALLEL_GRAIN
+    /**
+     * Default amount of elements each thread processes at a time in a parallel traversal. Smaller grains
+     * balance the work better, bigger grains have less overhead. See DynarrParallelForEach().
+     */
+    #define DYNARR_PARALLEL_GRAIN 4096
+#endif // DYNARR_PARALLEL_GRAIN
+
+#ifndef DYNARR_INLINE_SIZE
+    /**
+     * Amount of bytes every DynamicArray reserves to store its first elements without allocating any
+     * memory. See DynarrInitInline(). Set it to 0 to disable it. The library and the programs that
+     * use it must be compiled with the same value.
+     */
+    #define DYNARR_INLINE_SIZE 32
+#endif // DYNARR_INLINE_SIZE
+
+#ifndef DYNARR_CACHE_LINE_SIZE
+    /**
+     * Size of a cache line, in bytes. Use it as the alignment of arrays whose elements are processed
+     * with SIMD instructions or written with non-temporal stores. See NewDynamicArrayAligned().
+     */
+    #define DYNARR_CACHE_LINE_SIZE 64
+#endif // DYNARR_CACHE_LINE_SIZE
+
+#ifndef DYNARR_PAGE_SIZE
+    /**
+     * Size of a memory page, in bytes. Use it as the rounding of a growth policy to make large
+     * arrays occupy whole pages. See DynarrSetGrowth().
+     */
+    #define DYNARR_PAGE_SIZE 4096
+#endif // DYNARR_PAGE_SIZE
+
+#ifndef DYNARR_HUGE_PAGE_SIZE
+    /**
+     * Size of a huge memory page, in bytes. Use it as the rounding of a growth policy or as the alignment
+     * of an array to make very large arrays eligible for transparent huge pages. See DynarrSetGrowth()
+     * and NewDynamicArrayAligned().
+     */
+    #define DYNARR_HUGE_PAGE_SIZE 2097152
+#endif // DYNARR_HUGE_PAGE_SIZE
+
+#ifndef _DYNARR_COMPARISONS
+    #define _DYNARR_COMPARISONS
+    /**
+     * This enum represents a comparison between an element of a DynamicArray and a constant value. <br>
+     * It's used by the functions that filter primitive arrays without a <i>compar</i> callback.
+     */
+    enum DynarrComparison {
+        DynEqual = 1, DynNotEqual,      // Equality
+        DynLess, DynLessEqual,          // Elements smaller than the value
+        DynGreater, DynGreaterEqual     // Elements bigger than the value
+    };
+#endif // _DYNARR_COMPARISONS
+
+#ifndef _DYNARR_SUMMATIONS
+    #define _DYNARR_SUMMATIONS
+    /**
+     * This enum represents the algorithm used to add up floating-point elements. <br>
+     * \c DynSumSimple is the fastest, \c DynSumKahan is the most accurate.
+     */
+    enum DynarrSummation {
+        DynSumSimple = 1,   // Independent partial sums, added together at the end
+        DynSumPairwise,     // Recursively adds up both halves of the array
+        DynSumKahan         // Compensated summation
+    };
+#endif // _DYNARR_SUMMATIONS
+
+#ifndef _DYNARR_ORDERS
+    #define _DYNARR_ORDERS
+    /**
+     * This enum represents the order the elements of a DynamicArray are known to be in. <br>
+     * It's set by DynarrSort() and DynarrSortDesc(), kept up to date by the functions that modify the
+     * array and used by the functions that require a sorted array, such as DynarrBinarySearch().
+     */
+    enum DynarrOrder {
+        DynUnsorted = 0,    // The order of the elements is unknown
+        DynAscending,       // Sorted as by DynarrSort()
+        DynDescending       // Sorted as by DynarrSortDesc()
+    };
+#endif // _DYNARR_ORDERS
+
+#ifndef _DYNARR_STORAGES
+    #define _DYNARR_STORAGES
+    /**
+     * This enum represents where the elements of a DynamicArray are stored.
+     */
+    enum DynarrStorage {
+        DynHeap = 0,        // Memory allocated with malloc()
+        DynMapped,          // A file mapped into memory. See NewDynamicArrayMapped()
+        DynCopyOnWrite,     // A private mapping of a saved file, moved to the heap when it grows. See DynarrLoadMapped()
+        DynInline           // The inline buffer of the DynamicArray itself, moved to the heap when it grows. See DynarrInitInline()
+    };
+#endif // _DYNARR_STORAGES
+
+/**
+ * This object describes the elements of a DynamicArray of type \c Custom, such as structs. <br>
+ * The elements are stored contiguously in the array. Pass it to <u>NewDynamicArrayCustom()</u>. It's
+ * referenced by the array rather than copied, so it must outlive it. A static constant is ideal.
+ */
+struct DynarrCustomType
+{
+    size_t Size;                                /**< Size of each element, in bytes. It must be a multiple of the alignment. */
+    size_t Alignment;                           /**< Alignment of each element, in bytes. It must be a power of 2, or zero for the default alignment. */
+    void (*Copy)(void*, const void*);           /**< Copies the element at the second pointer into the uninitialized memory at the first one. If NULL, elements are copied byte by byte. */
+    void (*Destroy)(void*);                     /**< Releases the resources owned by an element that is removed from the array. Can be NULL. */
+    int (*Compare)(const void*, const void*);   /**< Compares two elements, like the <i>compar</i> function of \c qsort(). If NULL, elements are matched by their bytes and can't be sorted. */
+};
+
+/**
+ * This object represents how a DynamicArray grows when it runs out of storage space. <br>
+ * Members set to zero take their default values. Use DynarrSetGrowth() to change it.
+ */
+struct DynarrGrowth
+{
+    float Factor;               /**< The capacity is multiplied by this value when the array grows. Defaults to 2. */
+    size_t MaxStep;             /**< Maximum amount of elements added to the capacity at once. Defaults to no limit. */
+    size_t Rounding;            /**< Buffers of at least this many bytes are rounded up to a multiple of it. Defaults to no rounding. */
+};
+
 /**
  * This object represents an array that's able to safely expand its storage space as needed. <br>
  * Please, do not manipulate its members directly. Use the functions prefixed with <i>Dynarr</i>
@@ -55,34 +189,134 @@
 typedef struct DynamicArray
 {
     void* Array;                /**< Pointer that points to the beginning of the array. */
-    unsigned short Capacity;    /**< Represents the amount of elements the array is able to store before requiring a memory reallocation. */
-    unsigned short Count;       /**< Represents the amount of elements stored in the array. */
+    size_t Capacity;            /**< Represents the amount of elements the array is able to store before requiring a memory reallocation. */
+    size_t Count;               /**< Represents the amount of elements stored in the array. */
+    size_t TypeSize;            /**< Represents the size of the data type of the elements stored in the array, in bytes. */
     unsigned short Type;        /**< Represents the data type of the elements stored in the array. */
-    unsigned short TypeSize;    /**< Represents the size of the data type of the elements stored in the array, in bytes. */
+    unsigned short Sorted;      /**< Represents the order the elements are known to be in. See \c enum \c DynarrOrder. */
+    unsigned short Storage;     /**< Represents where the elements are stored. See \c enum \c DynarrStorage. */
+    struct DynarrGrowth Growth; /**< Represents how the array grows when it runs out of storage space. */
+    size_t Alignment;           /**< Represents the alignment of the array, in bytes, kept across reallocations. Zero for the default alignment. */
+    const struct DynarrCustomType* Custom;  /**< Describes the elements of arrays of type \c Custom. Null for any other type. */
+    int File;                   /**< File descriptor of the file the elements are mapped from. Only used by mapped arrays. */
+    #if DYNARR_INLINE_SIZE > 0
+        _Alignas(max_align_t) unsigned char Inline[DYNARR_INLINE_SIZE];    /**< Stores the elements of small arrays initialized with DynarrInitInline(). */
+    #endif // DYNARR_INLINE_SIZE
 }DynamicArray, Dynarr;          /**< Alias for declaring a DynamicArray. It's equivalent to <u>struct DynamicArray vName</u> or <u>DynamicArray vName</u>. */
 
+/**
+ * This object represents a range of elements of a DynamicArray, accessed without copying them. <br>
+ * It's cheap to create and doesn't own any memory, so it doesn't need to be cleared. <br>
+ * Use the <u>DynarrGetView()</u> function to instantiate a new DynarrView, and the functions
+ * prefixed with <i>DynarrView</i> to read it. They all access the elements in place, whatever the
+ * stride, except for sorting, which is limited to views of adjacent elements.
+ */
+typedef struct DynarrView
+{
+    struct DynamicArray* Base;  /**< Pointer to the DynamicArray the elements belong to. */
+    size_t Offset;              /**< Represents the index in <i>Base</i> of the first element of the view. */
+    size_t Count;               /**< Represents the amount of elements in the view. */
+    size_t Stride;              /**< Represents the distance in <i>Base</i> between two consecutive elements of the view. */
+}DynarrView;
+
+/**
+ * This object represents an append-only array that many threads can add elements to at the same time,
+ * without locks. <br>
+ * The elements are stored in segments that double in size and are never moved, so readers can access
+ * them while writers add more. Readers only see the published elements: the longest prefix of the array
+ * whose elements have been completely written. Elements that couldn't be added for lack of memory leave
+ * empty slots, which are published too but can't be read. <br>
+ * Use the <u>NewDynarrConcurrent()</u> function to instantiate a new DynarrConcurrent, and the functions
+ * prefixed with <i>DynarrConcurrent</i> to handle it.
+ */
+typedef struct DynarrConcurrent
+{
+    _Alignas(DYNARR_CACHE_LINE_SIZE) size_t Reserved;   /**< Represents the amount of elements claimed by writers, including the ones still being written. */
+    _Alignas(DYNARR_CACHE_LINE_SIZE) size_t Published;  /**< Represents the amount of elements visible to readers. */
+    _Alignas(DYNARR_CACHE_LINE_SIZE) void* Segments[sizeof(size_t) * 8];   /**< Pointers to the segments, each twice as big as the previous one. Allocated when first needed. */
+    size_t TypeSize;            /**< Represents the size of the data type of the elements stored in the array, in bytes. */
+    unsigned short Type;        /**< Represents the data type of the elements stored in the array. */
+}DynarrConcurrent;
+
 
 // Function prototyping
-extern struct DynamicArray NewDynamicArray (int, enum DataType);
-extern unsigned short DynarrAdd (struct DynamicArray*, void*);
+extern struct DynamicArray NewDynamicArray (size_t, enum DataType);
+extern struct DynamicArray NewDynamicArrayCustom (size_t, const struct DynarrCustomType*);
+extern struct DynamicArray NewDynamicArrayAligned (size_t, enum DataType, size_t);
+extern int DynarrInitInline (struct DynamicArray*, enum DataType);
+extern struct DynamicArray NewDynamicArrayMapped (const char*, size_t, enum DataType);
+extern struct DynamicArray DynarrOpenMapped (const char*);
+extern int DynarrSync (struct DynamicArray*);
+extern int DynarrSave (struct DynamicArray*, const char*);
+extern struct DynamicArray DynarrLoad (const char*);
+extern struct DynamicArray DynarrLoadMapped (const char*, int);
+extern size_t DynarrAdd (struct DynamicArray*, void*);
 extern void DynarrJoin (struct DynamicArray*, struct DynamicArray*);
-extern int DynarrInsert (struct DynamicArray*, struct DynamicArray*, int);
-extern int DynarrInsertElem (void*, struct DynamicArray*, int, enum DataType);
-extern int DynarrInsertArray (void*, struct DynamicArray*, int, int, enum DataType);
-int DynarrIndexOf (struct DynamicArray*, void*);
-extern int DynarrRemove (struct DynamicArray*, int);
-extern int DynarrRemoveCustom (struct DynamicArray*, int (*)(const void*));
-extern void* DynarrGetElement(struct DynamicArray*, int);
-extern void DynarrSetElement(struct DynamicArray*, void*, int);
+extern void DynarrJoinMove (struct DynamicArray*, struct DynamicArray*);
+extern size_t DynarrInsert (struct DynamicArray*, struct DynamicArray*, size_t);
+extern size_t DynarrInsertElem (void*, struct DynamicArray*, size_t, enum DataType);
+extern size_t DynarrInsertArray (void*, struct DynamicArray*, size_t, size_t, enum DataType);
+extern size_t DynarrInsertSorted (struct DynamicArray*, void*);
+extern ptrdiff_t DynarrIndexOf (struct DynamicArray*, void*);
+extern ptrdiff_t DynarrLastIndexOf (struct DynamicArray*, void*);
+extern int DynarrContains (struct DynamicArray*, void*);
+extern size_t DynarrCount (struct DynamicArray*, void*);
+extern ptrdiff_t DynarrBinarySearch (struct DynamicArray*, void*);
+extern ptrdiff_t DynarrLowerBound (struct DynamicArray*, void*);
+extern ptrdiff_t DynarrUpperBound (struct DynamicArray*, void*);
+extern size_t DynarrRemove (struct DynamicArray*, size_t);
+extern size_t DynarrRemoveRange (struct DynamicArray*, size_t, size_t);
+extern size_t DynarrRemoveIndices (struct DynamicArray*, const size_t*, size_t);
+extern size_t DynarrRemoveCustom (struct DynamicArray*, int (*)(const void*));
+extern size_t DynarrRetainCustom (struct DynamicArray*, int (*)(const void*));
+extern size_t DynarrRemoveWhere (struct DynamicArray*, enum DynarrComparison, void*);
+extern size_t DynarrRetainWhere (struct DynamicArray*, enum DynarrComparison, void*);
+extern void* DynarrGetElement(struct DynamicArray*, size_t);
+extern void DynarrSetElement(struct DynamicArray*, void*, size_t);
 extern void DynarrPrint (struct DynamicArray*, char*);
 extern void DynarrPrintAll (struct DynamicArray*, char*);
-extern int DynarrTrim (struct DynamicArray*);
-extern void DynarrExpand (struct DynamicArray*, int);
+extern size_t DynarrTrim (struct DynamicArray*);
+extern void DynarrExpand (struct DynamicArray*, size_t);
+extern size_t DynarrReserve (struct DynamicArray*, size_t);
+extern int DynarrSetGrowth (struct DynamicArray*, float, size_t, size_t);
 extern void DynarrClear (struct DynamicArray*);
 extern void DynarrSort (struct DynamicArray*);
 extern void DynarrSortDesc (struct DynamicArray*);
 extern void DynarrSortCustom (struct DynamicArray*, int (*)(const void*, const void*));
-extern struct DynamicArray DynarrGetSubarray (struct DynamicArray*, int, int);
+extern void DynarrSortParallel (struct DynamicArray*, size_t);
+extern void DynarrSortDescParallel (struct DynamicArray*, size_t);
+extern void DynarrSortCustomParallel (struct DynamicArray*, int (*)(const void*, const void*), size_t);
+extern int DynarrPoolStart (size_t);
+extern void DynarrPoolStop (void);
+extern void DynarrParallelForEach (struct DynamicArray*, void (*)(void*, void*), void*, size_t);
+extern int DynarrParallelMap (struct DynamicArray*, struct DynamicArray*, void (*)(void*, const void*, void*), void*, size_t);
+extern struct DynamicArray DynarrParallelFilter (struct DynamicArray*, int (*)(const void*), size_t);
+extern struct DynarrConcurrent NewDynarrConcurrent (enum DataType);
+extern size_t DynarrConcurrentAdd (struct DynarrConcurrent*, void*);
+extern size_t DynarrConcurrentAddArray (struct DynarrConcurrent*, void*, size_t);
+extern size_t DynarrConcurrentCount (struct DynarrConcurrent*);
+extern void* DynarrConcurrentGet (struct DynarrConcurrent*, size_t);
+extern struct DynamicArray DynarrConcurrentToDynarr (struct DynarrConcurrent*);
+extern void DynarrConcurrentClear (struct DynarrConcurrent*);
+extern int DynarrSum (struct DynamicArray*, void*);
+extern int DynarrSumWith (struct DynamicArray*, void*, enum DynarrSummation);
+extern double DynarrMean (struct DynamicArray*);
+extern ptrdiff_t DynarrArgMin (struct DynamicArray*);
+extern ptrdiff_t DynarrArgMax (struct DynamicArray*);
+extern void* DynarrMin (struct DynamicArray*);
+extern void* DynarrMax (struct DynamicArray*);
+extern struct DynamicArray DynarrGetSubarray (struct DynamicArray*, size_t, size_t);
 extern struct DynamicArray DynarrGetSubarrayCustom (struct DynamicArray*, int (*)(const void*));
+extern struct DynarrView DynarrGetView (struct DynamicArray*, size_t, size_t, size_t);
+extern void* DynarrViewGetElement (struct DynarrView*, size_t);
+extern struct DynamicArray DynarrViewMaterialize (struct DynarrView*);
+extern ptrdiff_t DynarrViewIndexOf (struct DynarrView*, void*);
+extern void DynarrViewPrint (struct DynarrView*, char*);
+extern void DynarrViewSort (struct DynarrView*);
+extern void DynarrViewSortDesc (struct DynarrView*);
+extern int DynarrViewSum (struct DynarrView*, void*, enum DynarrSummation);
+extern double DynarrViewMean (struct DynarrView*);
+extern ptrdiff_t DynarrViewArgMin (struct DynarrView*);
+extern ptrdiff_t DynarrViewArgMax (struct DynarrView*);
 
 #endif // DYNARR_H
@@ -0,0 +1,58 @@
+ /**
+ * \file        dyndeq.h
+ * \author      Kotz#7922
+ * \version     1.0
+ * \copyright   <a href="https://www.apache.org/licenses/LICENSE-2.0">Apache Software License</a> (ASL)
+ * \date        17/10/2026
+ * \brief       Definition for a DynamicDeque and its supporting functions.
+ * \details     A dynamic deque is a double-ended queue whose elements are stored contiguously in a circular
+ * buffer. Elements can be added and removed at both ends in constant time, without allocating any memory
+ * per element, so it's a much faster stack or queue than a DynamicList.
+ * <br><br>
+ * It uses the same data types as a DynamicArray. The buffer doubles every time it runs out of space, and
+ * its capacity is always a power of 2. Use the functions in this library to manipulate the deque.
+ */
+
+#ifndef DYNDEQ_H    // Only include this header file if it hasn't been included in the calling file already
+#define DYNDEQ_H
+
+#include <stdio.h>      /* fprintf */
+#include <stddef.h>     /* size_t */
+#include <stdlib.h>     /* calloc, free */
+#include <string.h>     /* memcpy */
+#include "dynvar.h"     /* All Dynvar functions */
+#include "dynarr.h"     /* DataType, DynamicArray */
+
+/**
+ * This object represents a double-ended queue. It contains a pointer to a circular buffer, as well as some
+ * basic information about the elements stored in it. <br>
+ * Please, do not manipulate its members directly. Use the functions prefixed with <i>Dyndeq</i> to handle tasks
+ * related to this object. Use code completion to check all available functions. <br>
+ * Use the <u>NewDynamicDeque()</u> function to instantiate a new DynamicDeque.
+ */
+typedef struct DynamicDeque
+{
+    void* Array;                /**< Pointer to the circular buffer that stores the elements. */
+    size_t Capacity;            /**< Represents the amount of elements the buffer is able to store. Always a power of 2. */
+    size_t Count;               /**< Represents the amount of elements stored in the deque. */
+    size_t Head;                /**< Represents the position in the buffer of the first element of the deque. */
+    size_t TypeSize;            /**< Represents the size of the data type of the elements stored in the deque, in bytes. */
+    unsigned short Type;        /**< Represents the data type of the elements stored in the deque. */
+}DynamicDeque, Dyndeq;          /**< Alias for declaring a DynamicDeque. It's equivalent to <u>struct DynamicDeque dName</u> or <u>Dyndeq dName</u>. */
+
+// Function prototyping
+extern struct DynamicDeque NewDynamicDeque (size_t, enum DataType);
+extern size_t DyndeqPushBack (struct DynamicDeque*, void*);
+extern size_t DyndeqPushFront (struct DynamicDeque*, void*);
+extern int DyndeqPopBack (struct DynamicDeque*, void*);
+extern int DyndeqPopFront (struct DynamicDeque*, void*);
+extern void* DyndeqPeekBack (struct DynamicDeque*);
+extern void* DyndeqPeekFront (struct DynamicDeque*);
+extern void* DyndeqGetElement (struct DynamicDeque*, size_t);
+extern size_t DyndeqEnqueue (struct DynamicDeque*, void*, size_t);
+extern size_t DyndeqDequeue (struct DynamicDeque*, void*, size_t);
+extern size_t DyndeqReserve (struct DynamicDeque*, size_t);
+extern struct DynamicArray DyndeqToDynarr (struct DynamicDeque*);
+extern void DyndeqClear (struct DynamicDeque*);
+
+#endif // DYNDEQ_H
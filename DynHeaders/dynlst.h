@@ -15,6 +15,8 @@
  * The linked list can behave either as a stack (if you only use the <u>DynlstPush()</u> and <u>DynlstPop()</u>
  * functions) or as a queue (if you only use the <u>DynlstEnqueue()</u> and <u>DynlstDequeue()</u> functions).
  * Additionally, you are also free to add and remove new elements anywhere in the list.
+ * Lists that are often accessed at random positions can be given an index with <u>DynlstIndexBuild()</u>,
+ * which makes these accesses take logarithmic time.
  * <br><br>
  * Linked lists use considerably more memory and are slower to process compared to dynamic arrays. On the other
  * hand, they don't need to be stored contiguously in the memory and are often used as a base for other,
@@ -27,6 +29,7 @@
 #define DYNLST_H
 
 #include <stdio.h>      /* printf, fprintf */
+#include <stddef.h>     /* max_align_t, offsetof */
 #include <stdlib.h>     /* malloc, free */
 #include <string.h>     /* memcmp */
 #include "dynvar.h"     /* All Dynvar functions */
@@ -45,6 +48,32 @@
     };
 #endif // _DYN_DTYPES
 
+#ifndef DYNLST_INLINE_SIZE
+    /**
+     * Amount of bytes every list element reserves to store its data. Data that fits in it is stored in
+     * the element itself, and the element is taken from the slabs of the list. Larger data is stored
+     * right after an element allocated on its own. The library and the programs that use it must be
+     * compiled with the same value.
+     */
+    #define DYNLST_INLINE_SIZE 16
+#endif // DYNLST_INLINE_SIZE
+
+#ifndef DYNLST_SLAB_SIZE
+    /**
+     * Maximum amount of list elements allocated at once by a DynamicList. The first slab of a list
+     * holds 16 elements, and each new slab doubles in size until it reaches this amount.
+     */
+    #define DYNLST_SLAB_SIZE 1024
+#endif // DYNLST_SLAB_SIZE
+
+#ifndef DYNLST_UNROLL_SIZE
+    /**
+     * Amount of bytes of elements stored in each node of a DynamicUnrolledList. It defaults to the size of a
+     * cache line. Nodes always hold at least 4 elements.
+     */
+    #define DYNLST_UNROLL_SIZE 64
+#endif // DYNLST_UNROLL_SIZE
+
 #ifndef _DYN_LST_MACROS
     #define _DYN_LST_MACROS
 
@@ -58,7 +87,10 @@
             .Last = NULL,               \
             .Count = 0,                 \
             .Size = 0,                  \
-            .TotalSize = sizeof(Dynlst) \
+            .TotalSize = sizeof(Dynlst),\
+            .Slabs = NULL,              \
+            .Spare = NULL,              \
+            .Index = NULL               \
         }
 
 #endif // _DYN_LST_MACROS
@@ -67,6 +99,7 @@
  * This object represents the element of a list. It contains a pointer to the stored data, as well as pointers
  * to the next and previous list elements. The \c Prev pointer of the first element and the \c Next pointer of
  * the last element will always be NULL. It also keeps track of basic information about the stored data. <br>
+ * The stored data is kept in the same allocation as the element, so \c Data always points to \c Inline. <br>
  * Please, avoid manipulating its members directly or indirectly.
  */
 typedef struct __DynlstElem
@@ -77,6 +110,7 @@ typedef struct __DynlstElem
     unsigned short Type;        /**< Represents the data type of the data stored in this list element. */
     unsigned short TypeSize;    /**< Represents the size of the data type of the data stored in the list element, in bytes. */
     unsigned int DataSize;      /**< Represents the storage space occupied by the stored data in the memory stream, in bytes */
+    _Alignas(max_align_t) unsigned char Inline[DYNLST_INLINE_SIZE];   /**< Stores the data. Data larger than this extends past the end of the element. */
 }__DynlstElem;
 
 /**
@@ -93,8 +127,61 @@ typedef struct DynlstHeader
     unsigned int Count;         /**< Amount of elements contained in the list. */
     unsigned int Size;          /**< Storage space allocated for all the stored data in the list, in bytes. */
     unsigned int TotalSize;     /**< Storage space allocated for all the stored data in the list, for the element objects themselves and the list header. */
+    struct __DynlstSlab* Slabs; /**< Pointer to the most recent block of list elements allocated by the list. */
+    struct __DynlstElem* Spare; /**< Pointer to the first of the list elements that were removed and can be reused. */
+    struct __DynlstIndex* Index;/**< Pointer to the index of the list, or NULL if it has none. See <u>DynlstIndexBuild()</u>. */
 }DynamicList, Dynlst;           /**< Alias for declaring a DynamicList. It's equivalent to <u>struct DynlstHeader lName</u> or <u>Dynlst lName</u>. */
 
+/**
+ * This object represents a position in a linked list. It points to a list element and keeps track of its index,
+ * so moving to the next or previous element and editing the list at the cursor take constant time. The index
+ * can be used with the other functions prefixed with <i>Dynlst</i>. <br>
+ * A cursor stays valid as long as the list is only edited through it. Editing the list by any other means
+ * may invalidate it. <br>
+ * Please, do not manipulate its members directly. Use the functions prefixed with <i>DynlstCursor</i> to handle
+ * tasks related to this object. <br>
+ * Use the <u>DynlstCursorAt()</u> function to instantiate a new DynlstCursor.
+ */
+typedef struct DynlstCursor
+{
+    struct DynlstHeader* List;      /**< Pointer to the header of the linked list. */
+    struct __DynlstElem* Element;   /**< Pointer to the list element at the cursor, or NULL if the cursor is past the end of the list. */
+    int Index;                      /**< Index of the list element at the cursor. Equal to the amount of elements in the list if the cursor is past its end. */
+}DynlstCursor;
+
+/**
+ * This object represents a node of an unrolled list. It contains a small block of contiguous elements, as well as
+ * pointers to the next and previous nodes. <br>
+ * Please, avoid manipulating its members directly or indirectly.
+ */
+typedef struct __DynulstNode
+{
+    struct __DynulstNode* Next; /**< Pointer to the next node in the list. */
+    struct __DynulstNode* Prev; /**< Pointer to the previous node in the list. */
+    unsigned int Count;         /**< Amount of elements contained in this node. */
+    _Alignas(max_align_t) unsigned char Data[];     /**< The elements stored in this node. */
+}__DynulstNode;
+
+/**
+ * This object represents an unrolled linked list. Each of its nodes stores several elements of the same type
+ * contiguously, so traversing it mostly reads sequential memory. Nodes are split when an element is added to
+ * a full node and merged when they become less than half full. <br>
+ * It stores elements of a single type: integers, floating-point numbers, pointers or dynamic variables. Its functions
+ * behave the same as their DynamicList counterparts. <br>
+ * Please, do not manipulate its members directly. Use the functions prefixed with <i>Dynulst</i> to handle tasks
+ * related to this object. Use code completion to check all available functions. <br>
+ * Use the <u>NewDynamicUnrolledList()</u> function to instantiate a new DynamicUnrolledList.
+ */
+typedef struct DynamicUnrolledList
+{
+    struct __DynulstNode* First;    /**< Pointer to the first node in the list. */
+    struct __DynulstNode* Last;     /**< Pointer to the last node in the list. */
+    unsigned int Count;             /**< Amount of elements contained in the list. */
+    unsigned int NodeCapacity;      /**< Amount of elements each node is able to store. */
+    unsigned short TypeSize;        /**< Represents the size of the data type of the elements stored in the list, in bytes. */
+    unsigned short Type;            /**< Represents the data type of the elements stored in the list. */
+}DynamicUnrolledList, Dynulst;      /**< Alias for declaring a DynamicUnrolledList. It's equivalent to <u>struct DynamicUnrolledList lName</u> or <u>Dynulst lName</u>. */
+
 // Function prototyping
 extern void DynlstAdd (struct DynlstHeader*, void*, int, enum DataType);
 extern void DynlstPush (struct DynlstHeader*, void*, enum DataType);
@@ -109,5 +196,30 @@ extern void DynlstPrintElem (struct DynlstHeader*, int, char*);
 extern void DynlstSet (struct DynlstHeader*, void*, int, enum DataType);
 extern int DynlstIndexOf (struct DynlstHeader*, void*, int);
 extern struct __DynlstElem* DynlstGet (struct DynlstHeader*, int);
+extern void DynlstSort (struct DynlstHeader*);
+extern void DynlstSortDesc (struct DynlstHeader*);
+extern void DynlstSortCustom (struct DynlstHeader*, int (*)(const struct __DynlstElem*, const struct __DynlstElem*));
+extern int DynlstIndexBuild (struct DynlstHeader*);
+extern void DynlstIndexClear (struct DynlstHeader*);
+extern struct DynlstCursor DynlstCursorAt (struct DynlstHeader*, int);
+extern int DynlstCursorNext (struct DynlstCursor*);
+extern int DynlstCursorPrev (struct DynlstCursor*);
+extern struct __DynlstElem* DynlstCursorGet (struct DynlstCursor*);
+extern void DynlstCursorSet (struct DynlstCursor*, void*, enum DataType);
+extern void DynlstCursorInsertBefore (struct DynlstCursor*, void*, enum DataType);
+extern void DynlstCursorInsertAfter (struct DynlstCursor*, void*, enum DataType);
+extern void DynlstCursorRemove (struct DynlstCursor*);
+extern struct DynamicUnrolledList NewDynamicUnrolledList (enum DataType);
+extern void DynulstAdd (struct DynamicUnrolledList*, void*, int);
+extern void DynulstPush (struct DynamicUnrolledList*, void*);
+extern void DynulstPop (struct DynamicUnrolledList*);
+extern void DynulstEnqueue (struct DynamicUnrolledList*, void*);
+extern void DynulstDequeue (struct DynamicUnrolledList*);
+extern void DynulstRemove (struct DynamicUnrolledList*, int);
+extern void DynulstSet (struct DynamicUnrolledList*, void*, int);
+extern void* DynulstGet (struct DynamicUnrolledList*, int);
+extern int DynulstIndexOf (struct DynamicUnrolledList*, void*);
+extern void DynulstPrint (struct DynamicUnrolledList*, char*);
+extern void DynulstClear (struct DynamicUnrolledList*);
 
 #endif // DYNLST_H
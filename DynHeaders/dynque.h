@@ -0,0 +1,101 @@
+ /**
+ * \file        dynque.h
+ * \author      Kotz#7922
+ * \version     1.0
+ * \copyright   <a href="https://www.apache.org/licenses/LICENSE-2.0">Apache Software License</a> (ASL)
+ * \date        17/10/2026
+ * \brief       Definition for lock-free queues and their supporting functions.
+ * \details     These queues hand elements over from one thread to another without locks. They have a fixed
+ * capacity, which is always a power of 2, and store elements of the integer, floating-point and pointer
+ * types, by value.
+ * <br><br>
+ * A DynamicSpscQueue can be used by exactly one producer thread and one consumer thread at the same time.
+ * A DynamicMpmcQueue can be used by any amount of producer and consumer threads, at a somewhat higher
+ * cost. The indices written by producers and consumers are kept in separate cache lines, so they don't
+ * slow each other down.
+ */
+
+#ifndef DYNQUE_H    // Only include this header file if it hasn't been included in the calling file already
+#define DYNQUE_H
+
+#include <stdio.h>      /* fprintf */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* SIZE_MAX */
+#include <stdlib.h>     /* aligned_alloc, free */
+#include <string.h>     /* memcpy */
+
+#ifndef _DYN_DTYPES
+    #define _DYN_DTYPES
+    /**
+     * This global enum represents a data type. <br>
+     * Use code completion to see the available types.
+     */
+    enum DataType {
+        Char = 1, Short, Int, Long, LLong,  // Signed integer types
+        UChar, UShort, UInt, ULong, ULLong, // Unsigned integer types
+        Float, Double, LDouble,             // Floating-point types
+        String, Custom, Var, Ptr            // Strings, structs, DynamicVariables and pointers
+    };
+#endif // _DYN_DTYPES
+
+#ifndef DYNQUE_CACHE_LINE_SIZE
+    /**
+     * Size of a cache line, in bytes. Indices written by different threads are placed this far apart.
+     */
+    #define DYNQUE_CACHE_LINE_SIZE 64
+#endif // DYNQUE_CACHE_LINE_SIZE
+
+/**
+ * This object represents a lock-free queue for a single producer thread and a single consumer thread. <br>
+ * Please, do not manipulate its members directly. Use the functions prefixed with <i>Dynspsc</i> to handle tasks
+ * related to this object. Use code completion to check all available functions. <br>
+ * Use the <u>NewDynamicSpscQueue()</u> function to instantiate a new DynamicSpscQueue.
+ */
+typedef struct DynamicSpscQueue
+{
+    _Alignas(DYNQUE_CACHE_LINE_SIZE) size_t Head;   /**< Index of the next element to be removed. Only written by the consumer. */
+    size_t CachedTail;          /**< Last value of <i>Tail</i> seen by the consumer. */
+    _Alignas(DYNQUE_CACHE_LINE_SIZE) size_t Tail;   /**< Index of the next element to be added. Only written by the producer. */
+    size_t CachedHead;          /**< Last value of <i>Head</i> seen by the producer. */
+    _Alignas(DYNQUE_CACHE_LINE_SIZE) void* Array;   /**< Pointer to the circular buffer that stores the elements. */
+    size_t Capacity;            /**< Represents the amount of elements the queue is able to store. Always a power of 2. */
+    size_t TypeSize;            /**< Represents the size of the data type of the elements stored in the queue, in bytes. */
+    unsigned short Type;        /**< Represents the data type of the elements stored in the queue. */
+}DynamicSpscQueue, Dynspsc;     /**< Alias for declaring a DynamicSpscQueue. It's equivalent to <u>struct DynamicSpscQueue qName</u> or <u>Dynspsc qName</u>. */
+
+/**
+ * This object represents a lock-free queue for any amount of producer and consumer threads. <br>
+ * Each slot of the queue carries a sequence number that tells whether it's ready to be written or read,
+ * so threads only contend on the index they increment. <br>
+ * Please, do not manipulate its members directly. Use the functions prefixed with <i>Dynmpmc</i> to handle tasks
+ * related to this object. Use code completion to check all available functions. <br>
+ * Use the <u>NewDynamicMpmcQueue()</u> function to instantiate a new DynamicMpmcQueue.
+ */
+typedef struct DynamicMpmcQueue
+{
+    _Alignas(DYNQUE_CACHE_LINE_SIZE) size_t Tail;   /**< Index of the next slot to be claimed by a producer. */
+    _Alignas(DYNQUE_CACHE_LINE_SIZE) size_t Head;   /**< Index of the next slot to be claimed by a consumer. */
+    _Alignas(DYNQUE_CACHE_LINE_SIZE) void* Slots;   /**< Pointer to the circular buffer of slots. Each one is a sequence number followed by an element. */
+    size_t Capacity;            /**< Represents the amount of elements the queue is able to store. Always a power of 2. */
+    size_t SlotSize;            /**< Represents the size of each slot, in bytes. */
+    size_t TypeSize;            /**< Represents the size of the data type of the elements stored in the queue, in bytes. */
+    unsigned short Type;        /**< Represents the data type of the elements stored in the queue. */
+}DynamicMpmcQueue, Dynmpmc;     /**< Alias for declaring a DynamicMpmcQueue. It's equivalent to <u>struct DynamicMpmcQueue qName</u> or <u>Dynmpmc qName</u>. */
+
+// Function prototyping
+extern struct DynamicSpscQueue NewDynamicSpscQueue (size_t, enum DataType);
+extern int DynspscPush (struct DynamicSpscQueue*, const void*);
+extern int DynspscPop (struct DynamicSpscQueue*, void*);
+extern size_t DynspscPushBatch (struct DynamicSpscQueue*, const void*, size_t);
+extern size_t DynspscPopBatch (struct DynamicSpscQueue*, void*, size_t);
+extern size_t DynspscCount (struct DynamicSpscQueue*);
+extern void DynspscClear (struct DynamicSpscQueue*);
+extern struct DynamicMpmcQueue NewDynamicMpmcQueue (size_t, enum DataType);
+extern int DynmpmcPush (struct DynamicMpmcQueue*, const void*);
+extern int DynmpmcPop (struct DynamicMpmcQueue*, void*);
+extern size_t DynmpmcPushBatch (struct DynamicMpmcQueue*, const void*, size_t);
+extern size_t DynmpmcPopBatch (struct DynamicMpmcQueue*, void*, size_t);
+extern size_t DynmpmcCount (struct DynamicMpmcQueue*);
+extern void DynmpmcClear (struct DynamicMpmcQueue*);
+
+#endif // DYNQUE_H
@@ -0,0 +1,44 @@
+ /**
+ * \file        dynsize.h
+ * \author      Kotz#7922
+ * \version     1.0
+ * \copyright   <a href="https://www.apache.org/licenses/LICENSE-2.0">Apache Software License</a> (ASL)
+ * \date        17/10/2026
+ * \brief       Private helpers shared by the sources of the dynamic collections.
+ * \details     This header is only meant to be included by the source files of this library, after the
+ * header of their own collection, which defines the DataType enum.
+ */
+
+#ifndef DYNSIZE_H   // Only include this header file if it hasn't been included in the calling file already
+#define DYNSIZE_H
+
+#include <stddef.h>     /* size_t */
+
+/** \brief Returns the size of the integer and floating-point types.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] DType The data type.
+ * \retval size_t
+ * \arg Returns the size of the type, in bytes, or zero if it's not an integer or floating-point type.
+ */
+static inline size_t __Dyn_SizeOf (enum DataType DType)
+{
+    switch (DType)
+    {
+        case Char:      return sizeof(signed char);
+        case Short:     return sizeof(short);
+        case Int:       return sizeof(int);
+        case Long:      return sizeof(long);
+        case LLong:     return sizeof(long long);
+        case UChar:     return sizeof(unsigned char);
+        case UShort:    return sizeof(unsigned short);
+        case UInt:      return sizeof(unsigned int);
+        case ULong:     return sizeof(unsigned long);
+        case ULLong:    return sizeof(unsigned long long);
+        case Float:     return sizeof(float);
+        case Double:    return sizeof(double);
+        case LDouble:   return sizeof(long double);
+        default:        return 0;
+    }
+}
+
+#endif // DYNSIZE_H
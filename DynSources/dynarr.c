@@ -1,23 +1,247 @@
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /* mremap */
+#endif // _GNU_SOURCE
+
 #include "../DynHeaders/dynarr.h"
+#include "../DynHeaders/dynsize.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    #define __DYNARR_X86_64
+    #include <immintrin.h>  /* SSE2 and AVX2 intrinsics */
+#endif // __x86_64__
+
+#include <pthread.h>        /* pthread_create, pthread_join, pthread_mutex_lock, pthread_cond_wait */
+
+#ifdef _WIN32
+    #include <malloc.h>     /* _aligned_malloc, _aligned_free */
+#endif // _WIN32
+
+#ifdef __linux__
+    #define __DYNARR_MMAP
+    #include <sys/mman.h>   /* mmap, mremap, msync, munmap */
+    #include <sys/stat.h>   /* fstat */
+    #include <fcntl.h>      /* open */
+    #include <unistd.h>     /* ftruncate, close */
+#endif // __linux__
+
+
+/* Private Types */
+
+/** \brief Represents what the search functions should look for.
+ * \warning <u>This is a private enum and is not meant to be directly accessed!</u>
+ */
+enum __DynarrSearchMode { __DynarrFindFirst, __DynarrFindLast, __DynarrFindCount };
+
+/** \brief Represents the reductions performed by __Dynarr_Reduce().
+ * \warning <u>This is a private enum and is not meant to be directly accessed!</u>
+ */
+enum __DynarrReduction { __DynarrSum, __DynarrArgMin, __DynarrArgMax };
+
+/** \brief Represents the beginning of the file of a mapped DynamicArray. The elements follow it.
+ * \remark Its size is a multiple of 64 bytes, so the elements are as aligned as the mapping itself.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynarrMapHeader
+{
+    char Magic[8];          /**< Identifies the file as a mapped DynamicArray. */
+    uint64_t Count;         /**< The amount of elements stored in the file, as of the last synchronization. */
+    uint64_t TypeSize;      /**< The size of each element, in bytes. */
+    uint16_t Type;          /**< The data type of the elements. */
+    uint16_t Sorted;        /**< The order the elements are known to be in. */
+    uint16_t Version;       /**< The version of the layout of the file. */
+    uint8_t Reserved[34];   /**< Pads the header to 64 bytes. */
+};
+
+/** \brief Represents the beginning of a file written by DynarrSave(). The elements follow it.
+ * \details Integer and floating-point elements are stored as raw data. Each dynamic variable is stored as
+ * its type (2 bytes), followed by the size of its data (4 bytes) and the data itself. All fields are
+ * written in the byte order of the machine that saved the file, which is recorded in <i>ByteOrder</i>.
+ * \remark Its size is a multiple of 64 bytes, so the elements are as aligned as a mapping of the file.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynarrSaveHeader
+{
+    char Magic[8];          /**< Identifies the file as a saved DynamicArray. */
+    uint32_t ByteOrder;     /**< Always 0x01020304, as written by the machine that saved the file. */
+    uint16_t Version;       /**< The version of the format of the file. */
+    uint16_t Type;          /**< The data type of the elements. */
+    uint64_t TypeSize;      /**< The size of each element in memory, in bytes. */
+    uint64_t Count;         /**< The amount of elements. */
+    uint64_t DataSize;      /**< The amount of bytes that follow the header. */
+    uint64_t Checksum;      /**< The checksum of the bytes that follow the header. See __Dynarr_ChecksumUpdate(). */
+    uint16_t Sorted;        /**< The order the elements are known to be in. */
+    uint8_t Reserved[14];   /**< Pads the header to 64 bytes. */
+};
+
+/** \brief Holds the progress of the calculation of a checksum.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynarrChecksum
+{
+    uint64_t Lanes[4];      /**< Independent hashes of every fourth 8-byte word. */
+    uint8_t Pending[32];    /**< Bytes that don't fill a whole block of words yet. */
+    size_t PendingBytes;    /**< The amount of bytes in <i>Pending</i>. */
+    uint64_t Length;        /**< The total amount of bytes hashed. */
+};
+
+/** \brief Identifies a file written by DynarrSave(). */
+#define __DYNARR_SAVE_MAGIC "DYNARRSV"
+
+/** \brief The version of the format of the files written by DynarrSave(). */
+#define __DYNARR_SAVE_VERSION 1
+
+/** \brief The value of the byte order marker of the files written by DynarrSave(). */
+#define __DYNARR_BYTE_ORDER 0x01020304u
+
+/** \brief The first segment of a DynarrConcurrent holds 2 to the power of this many elements. */
+#define __DYNARR_SEGMENT_SHIFT 6
+
+/** \brief The flag of a slot of a DynarrConcurrent whose element is completely written. */
+#define __DYNARR_SLOT_WRITTEN 1
+
+/** \brief The flag of a slot of a DynarrConcurrent that was left empty because its addition failed. */
+#define __DYNARR_SLOT_EMPTY 2
 
+/** \brief Identifies the file of a mapped DynamicArray. */
+#define __DYNARR_MAP_MAGIC "DYNARRMM"
 
-/* Private Variables */
+/** \brief The version of the layout of the files of mapped DynamicArrays. */
+#define __DYNARR_MAP_VERSION 1
+
+/** \brief Holds the bounds of the grains a thread of a parallel traversal has yet to process.
+ * \details The index of the next grain is stored in the upper half and the index past the last grain in
+ * the lower half, so both can be updated at once. The owner takes grains from the front and idle threads
+ * steal them from the back. Each range occupies its own cache line.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynarrGrainRange
+{
+    _Alignas(DYNARR_CACHE_LINE_SIZE) uint64_t Bounds;   /**< The packed bounds of the range. */
+};
+
+/** \brief Holds the state shared by the threads of a parallel traversal.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynarrParallelJob
+{
+    struct DynamicArray* sarray;                    /**< The array being traversed. */
+    struct DynamicArray* target;                    /**< The array that receives the results, if any. */
+    struct __DynarrParallelSort* sort;              /**< The parallel sort the traversal is part of, if any. */
+    void (*body)(struct __DynarrParallelJob*, size_t, size_t);  /**< Processes the elements in the specified range. */
+    void (*action)(void*, void*);                   /**< The function applied by DynarrParallelForEach(). */
+    void (*transform)(void*, const void*, void*);   /**< The function applied by DynarrParallelMap(). */
+    int (*predicate)(const void*);                  /**< The function applied by DynarrParallelFilter(). */
+    void* context;                                  /**< The argument passed to <i>action</i> and <i>transform</i>. */
+    unsigned char* selected;                        /**< Non-zero for each element accepted by <i>predicate</i>. */
+    size_t* offsets;                                /**< Amount of accepted elements in each grain, then where each grain starts in <i>target</i>. */
+    struct __DynarrGrainRange* ranges;              /**< The grains left for each thread. */
+    size_t participants;                            /**< Amount of threads working on the traversal. */
+    size_t count;                                   /**< Amount of elements to be traversed. */
+    size_t grain;                                   /**< Amount of elements in each grain. */
+    size_t grains;                                  /**< Amount of grains. */
+};
+
+/** \brief Holds the threads that run parallel traversals, which are kept alive between them.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynarrPool
+{
+    pthread_mutex_t submit;                 /**< Ensures only one traversal runs at a time. */
+    pthread_mutex_t lock;                   /**< Protects the fields below. */
+    pthread_cond_t wake;                    /**< Signaled when a traversal starts or the pool stops. */
+    pthread_cond_t done;                    /**< Signaled when the last thread finishes a traversal. */
+    pthread_t* handles;                     /**< The threads of the pool, or NULL if it's not running. */
+    size_t threads;                         /**< Amount of threads in the pool, not counting the calling thread. */
+    size_t busy;                            /**< Amount of threads still working on the current traversal. */
+    unsigned long generation;               /**< Increased every time a traversal starts. */
+    struct __DynarrParallelJob* job;        /**< The current traversal. */
+    int stop;                               /**< Non-zero if the threads must exit. */
+};
+
+/** \brief The pool shared by all parallel traversals.
+ * \warning <u>This is a private variable and is not meant to be directly accessed!</u>
+ */
+static struct __DynarrPool __Dynarr_Pool = {
+    .submit = PTHREAD_MUTEX_INITIALIZER,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER,
+    .done = PTHREAD_COND_INITIALIZER
+};
+
+/** \brief Non-zero in threads that are working on a parallel traversal, which must not start another one.
+ * \warning <u>This is a private variable and is not meant to be directly accessed!</u>
+ */
+static _Thread_local int __Dynarr_InPool;
 
-/** \brief  This variable keeps track of the data type of the DynamicArray that's currently being
- * sorted through DynarrSort() or DynarrSortDesc().
- * \warning <u>This is a private global variable and is not meant to be directly accessed!</u>
+/** \brief Stands in for the segments of a DynarrConcurrent that couldn't be allocated, whose slots are all empty.
+ * \warning <u>This is a private variable and is not meant to be directly accessed!</u>
  */
-static unsigned short __dynarr_GlobalComparType = 0;
+static unsigned char __Dynarr_DeadSegment;
+
+/* Unsigned integer types that are allowed to alias the elements of any array. */
+typedef uint8_t __attribute__((may_alias)) __dynarr_u8;
+typedef uint16_t __attribute__((may_alias)) __dynarr_u16;
+typedef uint32_t __attribute__((may_alias)) __dynarr_u32;
+typedef uint64_t __attribute__((may_alias)) __dynarr_u64;
 
 
 /* Private Functions */
 
-static void __Dynarr_NewArray (struct DynamicArray*, int, enum DataType);
-static int __Dynarr_RemoveElement (struct DynamicArray*, int);
-static void __Dynarr_SortArray (struct DynamicArray*, int (*)(const void*, const void*));
-static int __Dynarr_CompareByType (const void*, const void*);
-static int __Dynarr_CompareByTypeDesc (const void*, const void*);
+static void __Dynarr_NewArray (struct DynamicArray*, size_t, enum DataType);
+static int __Dynarr_Grow (struct DynamicArray*, size_t);
+static size_t __Dynarr_RemoveRange (struct DynamicArray*, size_t, size_t);
+static size_t __Dynarr_Compact (struct DynamicArray*, int (*)(const void*), int);
+static size_t __Dynarr_CompactWhere (struct DynamicArray*, enum DynarrComparison, void*, int);
+static void __Dynarr_SortArray (struct DynamicArray*, int);
+static int __Dynarr_CompareByType (const void*, const void*, enum DataType, size_t);
+static int __Dynarr_CompareVar (const void*, const void*);
+static int __Dynarr_CompareVarDesc (const void*, const void*);
+static void __Dynarr_SortParallel (struct DynamicArray*, size_t, int, int (*)(const void*, const void*));
+static size_t __Dynarr_ProcessorCount (void);
+static void* __Dynarr_PoolWorker (void*);
+static int __Dynarr_PoolCreate (size_t);
+static void __Dynarr_PoolDestroy (void);
+static void __Dynarr_SplitGrains (struct __DynarrParallelJob*, size_t, size_t);
+static int __Dynarr_TakeGrain (struct __DynarrGrainRange*, size_t*);
+static int __Dynarr_StealGrains (struct __DynarrGrainRange*, struct __DynarrGrainRange*);
+static void __Dynarr_RunGrains (struct __DynarrParallelJob*, size_t);
+static void __Dynarr_RunParallel (struct __DynarrParallelJob*);
+static void __Dynarr_ForEachRange (struct __DynarrParallelJob*, size_t, size_t);
+static void __Dynarr_MapRange (struct __DynarrParallelJob*, size_t, size_t);
+static void __Dynarr_SelectRange (struct __DynarrParallelJob*, size_t, size_t);
+static void __Dynarr_GatherRange (struct __DynarrParallelJob*, size_t, size_t);
+static void* __Dynarr_ConcurrentSlot (struct DynarrConcurrent*, size_t, unsigned char**);
+static int __Dynarr_ConcurrentAllocate (struct DynarrConcurrent*, size_t, size_t);
+static int __Dynarr_ConcurrentResolved (struct DynarrConcurrent*, size_t);
+static void __Dynarr_ConcurrentPublish (struct DynarrConcurrent*);
+static int __Dynarr_Reduce (struct DynarrView*, enum __DynarrReduction, void*, enum DynarrSummation);
+static double __Dynarr_Mean (struct DynarrView*);
 static int __Dynarr_VarCmp (struct DynamicVariable*, struct DynamicVariable*);
+static size_t __Dynarr_Search (struct DynamicArray*, void*, enum __DynarrSearchMode);
+static int __Dynarr_Matches (struct DynamicArray*, void*, void*);
+static void __Dynarr_MarkSorted (struct DynamicArray*, int);
+static void __Dynarr_UpdateOrder (struct DynamicArray*, size_t, size_t);
+static int __Dynarr_CompareOrder (struct DynamicArray*, const void*, const void*);
+static size_t __Dynarr_Bound (struct DynamicArray*, void*, int);
+static int __Dynarr_CheckView (struct DynarrView*);
+static struct DynamicArray __Dynarr_ViewWindow (struct DynarrView*, size_t, size_t);
+static void __Dynarr_SortView (struct DynarrView*, int);
+static void* __Dynarr_Allocate (size_t, size_t);
+static void* __Dynarr_Reallocate (size_t, void*, size_t, size_t);
+static void __Dynarr_FreeBuffer (size_t, void*);
+static void __Dynarr_CopyElements (struct DynamicArray*, void*, const void*, size_t);
+static void __Dynarr_ReleaseElements (struct DynamicArray*, size_t, size_t);
+static int __Dynarr_SameType (struct DynamicArray*, struct DynamicArray*);
+static struct DynamicArray __Dynarr_NewLike (struct DynamicArray*, size_t);
+static void __Dynarr_Reverse (void*, size_t, size_t);
+static int __Dynarr_Resize (struct DynamicArray*, size_t);
+static size_t __Dynarr_ElementSize (enum DataType);
+static void __Dynarr_Unmap (struct DynamicArray*);
+static void __Dynarr_ChecksumStart (struct __DynarrChecksum*);
+static void __Dynarr_ChecksumUpdate (struct __DynarrChecksum*, const void*, size_t);
+static uint64_t __Dynarr_ChecksumFinish (struct __DynarrChecksum*);
+static int __Dynarr_ReadSaveHeader (struct __DynarrSaveHeader*, FILE*);
+static void __Dynarr_SwapBytes (void*, size_t, size_t);
 
 
 /* Public Functions */
@@ -31,10 +255,10 @@ static int __Dynarr_VarCmp (struct DynamicVariable*, struct DynamicVariable*);
  * \arg If successful, the DynamicArray will contain a pointer to the allocated array.
  * \arg Otherwise, the DynamicArray will contain a null pointer.
  */
-struct DynamicArray NewDynamicArray (int initialCapacity, enum DataType DType)
+struct DynamicArray NewDynamicArray (size_t initialCapacity, enum DataType DType)
 {
     // If initial capacity is invalid, set it to default
-    if (initialCapacity <= 0)
+    if (initialCapacity == 0)
         initialCapacity = 10;
 
     // Create the struct that's going to be assigned to the calling struct
@@ -53,931 +277,4968 @@ struct DynamicArray NewDynamicArray (int initialCapacity, enum DataType DType)
     return sarray;
 }
 
-/** \brief Adds an element to a DynamicArray.
- *
- * \param[out] sarray Pointer to a DynamicArray.
- * \param[in] newElement Pointer to the element to be added.
- * \retval unsigned short
- * \arg If successful, returns the amount of elements contained in the array.
- * \arg Otherwise, returns zero.
+/** \brief Initializes an object of type DynamicArray that stores custom elements, such as structs.
+ * \details The elements are stored contiguously in the array, without any indirection. The callbacks of
+ * <i>custom</i> are used to copy, release, sort and search the elements.
+ * \param[in] initialCapacity The amount of elements the array should initially be able to store.
+ * \param[in] custom Pointer to the description of the elements. It must outlive the array.
+ * \retval struct DynamicArray
+ * \arg If successful, the DynamicArray will contain a pointer to the allocated array.
+ * \arg Otherwise, the DynamicArray will contain a null pointer.
  */
-unsigned short DynarrAdd (struct DynamicArray* sarray, void* newElement)
+struct DynamicArray NewDynamicArrayCustom (size_t initialCapacity, const struct DynarrCustomType* custom)
 {
-    void* tempPointer = NULL;
-    sarray->Count++;
+    struct DynamicArray sarray = { 0 };
 
-    // If count is going to exceed the capacity, expand the capacity
-    if (sarray->Count > sarray->Capacity)
+    if (custom->Size == 0 || (custom->Alignment & (custom->Alignment - 1)) || (custom->Alignment && custom->Size % custom->Alignment))
     {
-        sarray->Capacity *= 2; // Multiply capacity by 2
-        tempPointer = realloc(sarray->Array, sarray->Capacity * sarray->TypeSize);
-
-        if (tempPointer)
-        {
-            sarray->Array = tempPointer;
-        }
-        else
-        {
-            fprintf(stderr, "Error: failed to add an element to the dynamic array.\n");
-            return 0;
-        }
+        fprintf(stderr, "Error: invalid size or alignment. A null array was generated.\n");
+        return sarray;
     }
 
-    // Add the new element to the end of the array
-    if (sarray->Type == Var)
-    {
-        struct DynamicVariable copy = DynvarCopy(newElement);
-        memcpy(sarray->Array + sarray->TypeSize * (sarray->Count - 1), &copy, sarray->TypeSize);
-    }
-    else
+    // If initial capacity is invalid, set it to default
+    if (initialCapacity == 0)
+        initialCapacity = 10;
+
+    if (initialCapacity <= SIZE_MAX / custom->Size)
+        sarray.Array = __Dynarr_Allocate(custom->Alignment, initialCapacity * custom->Size);
+
+    if (!sarray.Array)
     {
-        memcpy(sarray->Array + sarray->TypeSize * (sarray->Count - 1), newElement, sarray->TypeSize);
+        fprintf(stderr, "Error: failed to allocate memory for the new dynamic array.\n");
+        return sarray;
     }
 
-    return sarray->Count;
-}
+    sarray.Capacity = initialCapacity;
+    sarray.Type = Custom;
+    sarray.TypeSize = custom->Size;
+    sarray.Alignment = custom->Alignment;
+    sarray.Custom = custom;
 
-/** \brief Inserts all elements of a DynamicArray into another DynamicArray at the specified index.
- *
- * \param[in] source Pointer to a DynamicArray to be copied from.
- * \param[out] target Pointer to a DynamicArray that will receive the elements.
- * \param[in] targetIndex Index at <i>target</i> where the new elements will be inserted to.
- * \retval int
- * \arg If successful, returns the starting index where the old elements of <i>target</i> have been moved to.
- * \arg Otherwise, returns zero.
- */
-int DynarrInsert (struct DynamicArray* source, struct DynamicArray* target, int targetIndex)
-{
-    return DynarrInsertArray(source->Array, target, source->Count, targetIndex, source->Type);
+    return sarray;
 }
 
-/** \brief Inserts one new element into a DynamicArray at the specified index.
- *
- * \param[in] source Pointer to the data to be copied from.
- * \param[out] target Pointer to a DynamicArray that will receive the element.
- * \param[in] targetIndex Index at <i>target</i> where the new element will be inserted to.
- * \param[in] DType The type of data to be inserted.
- * \retval int
- * \arg If successful, returns the starting index where the old elements of <i>target</i> have been moved to.
- * \arg Otherwise, returns zero.
+/** \brief Initializes an object of type DynamicArray whose array starts at an address that is a multiple of the specified alignment.
+ * \details The alignment is kept every time the array is reallocated, so SIMD code can rely on it for as
+ * long as the array exists. Arrays aligned to <b>DYNARR_HUGE_PAGE_SIZE</b> or more are also marked as eligible
+ * for transparent huge pages on Linux.
+ * \remark Only integer, floating-point, dynamic variable and pointer types are supported.
+ * \param[in] initialCapacity The amount of elements the array should initially be able to store.
+ * \param[in] DType The data type of the elements to be stored in the array.
+ * \param[in] alignment The alignment of the array, in bytes. It must be a power of 2, such as
+ * <b>DYNARR_CACHE_LINE_SIZE</b> or <b>DYNARR_HUGE_PAGE_SIZE</b>. Zero for the default alignment.
+ * \retval struct DynamicArray
+ * \arg If successful, the DynamicArray will contain a pointer to the allocated array.
+ * \arg Otherwise, the DynamicArray will contain a null pointer.
  */
-int DynarrInsertElem (void* source, struct DynamicArray* target, int targetIndex, enum DataType DType)
+struct DynamicArray NewDynamicArrayAligned (size_t initialCapacity, enum DataType DType, size_t alignment)
 {
-    return DynarrInsertArray(source, target, 1, targetIndex, DType);
+    struct DynamicArray sarray = { 0 };
+    size_t typeSize = __Dynarr_ElementSize(DType);
+
+    if (typeSize == 0)
+    {
+        fprintf(stderr, "Error: unrecognized type. A null array was generated.\n");
+        return sarray;
+    }
+    else if (alignment & (alignment - 1))
+    {
+        fprintf(stderr, "Error: the alignment must be a power of 2. A null array was generated.\n");
+        return sarray;
+    }
+
+    // If initial capacity is invalid, set it to default
+    if (initialCapacity == 0)
+        initialCapacity = 10;
+
+    if (initialCapacity <= SIZE_MAX / typeSize)
+        sarray.Array = __Dynarr_Allocate(alignment, initialCapacity * typeSize);
+
+    if (!sarray.Array)
+    {
+        fprintf(stderr, "Error: failed to allocate memory for the new dynamic array.\n");
+        return sarray;
+    }
+
+    sarray.Capacity = initialCapacity;
+    sarray.Type = DType;
+    sarray.TypeSize = typeSize;
+    sarray.Alignment = alignment;
+
+    return sarray;
 }
 
-/** \brief Inserts all elements of a collection into a DynamicArray at the specified index.
- *
- * \param[in] source Pointer to the collection of data to be inserted.
- * \param[out] target Pointer to a DynamicArray that will receive the data.
- * \param[in] sourceAmount Amount of elements to be added.
- * \param[in] targetIndex Index at <i>target</i> where the new elements will be inserted to.
- * \param[in] DType The type of data to be inserted.
+/** \brief Initializes a DynamicArray in place, storing its first elements inside of the DynamicArray itself.
+ * \details No memory is allocated until the elements outgrow the inline buffer of the array, which holds
+ * <b>DYNARR_INLINE_SIZE</b> bytes. Then they are moved to the heap and the array works like any other one.
+ * This makes short-lived arrays with a few elements much cheaper to create and clear.
+ * \warning The array points to its own buffer, so it must not be copied or moved by assignment while its
+ * storage is \c DynInline. Declare it where it's going to be used and pass it around by pointer.
+ * \remark Only integer, floating-point, dynamic variable and pointer types are supported.
+ * \param[out] sarray Pointer to the DynamicArray to be initialized. Its previous contents are ignored.
+ * \param[in] DType An enum representing the desired data type.
  * \retval int
- * \arg If successful, returns the starting index where the old elements of <i>target</i> have been moved to.
- * \arg Otherwise, returns zero.
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero and the DynamicArray will contain a null pointer.
  */
-int DynarrInsertArray (void* source, struct DynamicArray* target, int sourceAmount, int targetIndex, enum DataType DType)
+int DynarrInitInline (struct DynamicArray* sarray, enum DataType DType)
 {
-    if (DType != target->Type)
+    size_t typeSize = __Dynarr_ElementSize(DType);
+
+    *sarray = (struct DynamicArray){ .Type = DType, .TypeSize = typeSize };
+
+    if (typeSize == 0)
     {
-        fprintf(stderr, "Error: the dynamic arrays don't store data of the same type.\n");
+        fprintf(stderr, "Error: unrecognized type. A null array was generated.\n");
+        sarray->Type = 0;
         return 0;
     }
-    else if (targetIndex > target->Count) targetIndex = target->Count;
-    else if (targetIndex < 0) targetIndex = 0;
 
-    // Allocate extra memory if the insertion is going to exceed the current space
-    if (target->Count + sourceAmount > target->Capacity)
-    {
-        target->Capacity = target->Count + sourceAmount;
-        void* tempPointer = realloc(target->Array, target->Capacity * target->TypeSize);
+    #if DYNARR_INLINE_SIZE > 0
+        sarray->Array = sarray->Inline;
+        sarray->Capacity = sizeof(sarray->Inline) / typeSize;
+        sarray->Storage = DynInline;
+    #else
+        if (!(sarray->Array = calloc(10, typeSize)))
+        {
+            fprintf(stderr, "Error: failed to allocate memory for the new dynamic array.\n");
+            DynarrClear(sarray);
+            return 0;
+        }
+
+        sarray->Capacity = 10;
+    #endif // DYNARR_INLINE_SIZE
+
+    return 1;
+}
+
+/** \brief Initializes an object of type DynamicArray whose elements are stored in a file mapped into memory.
+ * \details The file is created, or truncated if it already exists. The array works just like any other one,
+ * but its memory is backed by the file instead of the heap, so it can be bigger than the available RAM
+ * and can be reopened with DynarrOpenMapped() after the program exits. DynarrClear() unmaps and closes the
+ * file without deleting it. By default, the mapping grows in whole memory pages.
+ * \remark Only integer and floating-point types are supported. Only available on Linux.
+ * \param[in] path The path to the file.
+ * \param[in] initialCapacity The amount of elements the array should initially be able to store.
+ * \param[in] DType The data type of the elements to be stored in the array.
+ * \retval struct DynamicArray
+ * \arg If successful, the DynamicArray will contain a pointer to the mapped array.
+ * \arg Otherwise, the DynamicArray will contain a null pointer.
+ */
+struct DynamicArray NewDynamicArrayMapped (const char* path, size_t initialCapacity, enum DataType DType)
+{
+    struct DynamicArray sarray = { 0 };
+
+    #ifdef __DYNARR_MMAP
+        struct __DynarrMapHeader* header;
+        size_t typeSize = __Dyn_SizeOf(DType), length;
+        void* mapping;
+        int file;
 
-        if (tempPointer)
+        if (typeSize == 0)
         {
-            target->Array = tempPointer;
+            fprintf(stderr, "Error: only integer and floating-point types can be mapped. A null array was generated.\n");
+            return sarray;
         }
-        else
+
+        // If initial capacity is invalid, set it to default
+        if (initialCapacity == 0)
+            initialCapacity = 10;
+
+        if (initialCapacity > (SIZE_MAX - sizeof(struct __DynarrMapHeader)) / typeSize)
         {
-            fprintf(stderr, "Error: failed to add a collection to the dynamic array.\n");
-            return 0;
+            fprintf(stderr, "Error: failed to allocate memory for the new dynamic array.\n");
+            return sarray;
         }
-    }
 
-    // Copy old data to its new location in the same array
-    // Think of the array as 3 distinct areas: index 0 to targetIndex, sourceAmount and the leftovers to the right (total - tIndex - sAmount)
-    memmove(
-        target->Array + ((targetIndex + sourceAmount) * target->TypeSize),  // Destination: one index after the last index the source is going to use
-        target->Array + (targetIndex * target->TypeSize),                   // Source: starts from the element at the specified index
-        (target->Count - targetIndex) * target->TypeSize                    // Copy all elements located to the right of the specified index
-    );
+        length = sizeof(struct __DynarrMapHeader) + (initialCapacity * typeSize);
 
-    // Copy new data from source to the target
-    memcpy(
-        target->Array + (targetIndex * target->TypeSize),   // Destination: starts from the specified index of target
-        source,                                             // Source: starts from the first index of source
-        sourceAmount * target->TypeSize
-    );
+        if ((file = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0)
+        {
+            fprintf(stderr, "Error: failed to create the file of the mapped dynamic array.\n");
+            return sarray;
+        }
 
-    // Update the count on the target
-    target->Count += sourceAmount;
+        if (ftruncate(file, length) != 0 || (mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0)) == MAP_FAILED)
+        {
+            fprintf(stderr, "Error: failed to map the file of the dynamic array.\n");
+            close(file);
+            return sarray;
+        }
 
-    return targetIndex + sourceAmount;
+        header = mapping;
+        memcpy(header->Magic, __DYNARR_MAP_MAGIC, sizeof(header->Magic));
+        header->TypeSize = typeSize;
+        header->Type = DType;
+        header->Version = __DYNARR_MAP_VERSION;
+
+        sarray.Array = mapping + sizeof(struct __DynarrMapHeader);
+        sarray.Capacity = initialCapacity;
+        sarray.TypeSize = typeSize;
+        sarray.Type = DType;
+        sarray.Storage = DynMapped;
+        sarray.File = file;
+        sarray.Growth.Rounding = DYNARR_PAGE_SIZE;
+    #else
+        (void)path;
+        (void)initialCapacity;
+        (void)DType;
+        fprintf(stderr, "Error: mapped dynamic arrays are not supported on this platform. A null array was generated.\n");
+    #endif // __DYNARR_MMAP
+
+    return sarray;
 }
 
-/** \brief Adds all elements from <i>source</i> to <i>target</i>.
- *
- * \param[in] source Pointer to a DynamicArray to have its data copied from.
- * \param[out] target Pointer to a DynamicArray to have data copied to.
- * \return \c void
+/** \brief Opens a file created by NewDynamicArrayMapped() and maps its elements back into memory.
+ * \remark The array contains the elements that were stored in it the last time it was synchronized
+ * with DynarrSync() or closed with DynarrClear(). Only available on Linux.
+ * \param[in] path The path to the file.
+ * \retval struct DynamicArray
+ * \arg If successful, the DynamicArray will contain a pointer to the mapped array.
+ * \arg Otherwise, the DynamicArray will contain a null pointer.
  */
-void DynarrJoin (struct DynamicArray* source, struct DynamicArray* target)
+struct DynamicArray DynarrOpenMapped (const char* path)
 {
-    if (source->Type != target->Type || source->Count == 0)
-        return;
+    struct DynamicArray sarray = { 0 };
 
-    for (int counter = 0; counter < source->Count; counter++)
-        DynarrAdd(target, source->Array + (source->TypeSize * counter));
-}
+    #ifdef __DYNARR_MMAP
+        struct __DynarrMapHeader* header;
+        struct stat status;
+        void* mapping;
+        int file;
 
-/** \brief Returns the index of the specified data in the DynamicArray,
- * if there is one.
- * \param[in] source Pointer to the collection of data to be inserted.
- * \param[in] element The data to be searched for.
- * \retval int
- * \arg Returns the index of the first element that matched the
- * specified data.
- * \arg If the data is not found in the array, returns -1.
- */
-int DynarrIndexOf (struct DynamicArray* sarray, void* element)
-{
-    // This is horrid, but memcmp() is stupid.
-    if (sarray->Type == Var)
-    {
-        for (int counter = 0; counter < sarray->Count; counter++)
+        if ((file = open(path, O_RDWR)) < 0)
         {
-            if (!__Dynarr_VarCmp(sarray->Array + (counter * sarray->TypeSize), element))
-                return counter;
+            fprintf(stderr, "Error: failed to open the file of the mapped dynamic array.\n");
+            return sarray;
         }
-    }
-    else
-    {
-        for (int counter = 0; counter < sarray->Count; counter++)
+
+        if (fstat(file, &status) != 0 || (size_t)status.st_size < sizeof(struct __DynarrMapHeader)
+            || (mapping = mmap(NULL, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0)) == MAP_FAILED)
         {
-            if (!memcmp(sarray->Array + (counter * sarray->TypeSize), element, sarray->TypeSize))
-                return counter;
+            fprintf(stderr, "Error: failed to map the file of the dynamic array.\n");
+            close(file);
+            return sarray;
         }
-    }
 
-    // Return -1 if data is not found in the array
-    return -1;
-}
+        header = mapping;
 
-/** \brief Deallocates the memory from the array of a DynamicArray and resets all its properties.
- *
- * \param[out] sarray Pointer to a DynamicArray.
- * \return \c void
- */
-void DynarrClear (struct DynamicArray* sarray)
-{
-    // If the array contains dynamic variables, deallocate each one of them first
-    if (sarray->Type == Var)
-    {
-        for (int counter = 0; counter < sarray->Count; counter++)
-            DynvarClear(&((Dynvar*)sarray->Array)[counter]);
-    }
+        // Make sure the file is valid before trusting its contents. The elements must fill the rest of the
+        // file exactly, as the mapping is later released and resized by the length of its elements.
+        if (memcmp(header->Magic, __DYNARR_MAP_MAGIC, sizeof(header->Magic)) || header->Version != __DYNARR_MAP_VERSION
+            || header->TypeSize == 0 || header->TypeSize != __Dyn_SizeOf(header->Type)
+            || (status.st_size - sizeof(struct __DynarrMapHeader)) % header->TypeSize != 0
+            || header->Count > (status.st_size - sizeof(struct __DynarrMapHeader)) / header->TypeSize)
+        {
+            fprintf(stderr, "Error: the file does not contain a valid mapped dynamic array.\n");
+            munmap(mapping, status.st_size);
+            close(file);
+            return sarray;
+        }
 
-    // Deallocate the array
-    free(sarray->Array);
+        sarray.Array = mapping + sizeof(struct __DynarrMapHeader);
+        sarray.Capacity = (status.st_size - sizeof(struct __DynarrMapHeader)) / header->TypeSize;
+        sarray.Count = header->Count;
+        sarray.TypeSize = header->TypeSize;
+        sarray.Type = header->Type;
+        sarray.Sorted = header->Sorted;
+        sarray.Storage = DynMapped;
+        sarray.File = file;
+        sarray.Growth.Rounding = DYNARR_PAGE_SIZE;
+    #else
+        (void)path;
+        fprintf(stderr, "Error: mapped dynamic arrays are not supported on this platform. A null array was generated.\n");
+    #endif // __DYNARR_MMAP
 
-    // Reset everything
-    sarray->Array = NULL;
-    sarray->Capacity = 0;
-    sarray->Count = 0;
-    sarray->Type = 0;
-    sarray->TypeSize = 0;
+    return sarray;
 }
 
-/** \brief Removes an element from a DynamicArray at the specified index.
- * \details This function basically shifts the entire array starting from the provided index.
- * \param[out] sarray Pointer to a DynamicArray.
- * \param[in] index Index of the element to be removed.
+/** \brief Writes the elements of a mapped DynamicArray to its file and waits for them to reach the disk.
+ * \remark The elements are written back eventually anyway, but the amount of elements is only saved by
+ * this function and DynarrClear(). Only available on Linux.
+ * \param[in] sarray Pointer to a mapped DynamicArray.
  * \retval int
- * \arg If successful, returns the amount of elements that got shifted.
+ * \arg If successful, returns non-zero.
  * \arg Otherwise, returns zero.
  */
-int DynarrRemove (struct DynamicArray* sarray, int index)
+int DynarrSync (struct DynamicArray* sarray)
 {
-    if (index > sarray->Count - 1)
+    if (sarray->Storage != DynMapped)
     {
-        fprintf(stderr, "Error: index out of range.\n");
+        fprintf(stderr, "Error: attempted to synchronize a dynamic array that is not mapped to a file.\n");
         return 0;
     }
 
-    // Remove the element at the specified index
-    int shifted = __Dynarr_RemoveElement(sarray, index);
-    sarray->Count--;
-
-    return shifted;
-}
+    #ifdef __DYNARR_MMAP
+        struct __DynarrMapHeader* header = sarray->Array - sizeof(struct __DynarrMapHeader);
 
-/** \brief Removes all elements specified by the <i>compar</i> function from a DynamicArray.
- *
- * \param[out] sarray Pointer to a DynamicArray.
- * \param[in] compar
- * \parblock
- * Pointer to a function that takes a void pointer as parameter and returns an \c int.
- * <br> The void pointer represents an element in the DynamicArray.
- * <br> The function must return zero for <u>false</u> evaluations and non-zero values for <u>true</u> evaluations.
- * \endparblock
- * \retval int
- * \arg Returns the amount of elements that got removed.
- */
-int DynarrRemoveCustom (struct DynamicArray* sarray, int (*compar)(const void*))
-{
-    int counter, removed;
+        header->Count = sarray->Count;
+        header->Sorted = sarray->Sorted;
 
-    // Remove array elements according to compar's specifications
-    for (counter = 0, removed = 0; counter < sarray->Count; counter++)
-    {
-        if(compar(sarray->Array + (sarray->TypeSize * counter)))
+        if (msync(header, sizeof(struct __DynarrMapHeader) + (sarray->Capacity * sarray->TypeSize), MS_SYNC) != 0)
         {
-            __Dynarr_RemoveElement(sarray, counter);
-            removed++;
-            sarray->Count--;
+            fprintf(stderr, "Error: failed to synchronize the dynamic array with its file.\n");
+            return 0;
         }
-    }
 
-    return removed;
+        return 1;
+    #else
+        return 0;
+    #endif // __DYNARR_MMAP
 }
 
-/** \brief Deallocates unused memory from a DynamicArray.
- * \remark Multiply the return value by the size of the data type to get the amount of bytes released.
- * \param[out] sarray Pointer to a DynamicArray.
+/** \brief Saves a DynamicArray to a file, in a compact binary format.
+ * \details The file starts with a header that describes the array and carries a checksum of its
+ * contents, followed by the raw elements. Dynamic variables are stored as length-prefixed data.
+ * The file can be loaded with DynarrLoad() or DynarrLoadMapped().
+ * \remark Only integer, floating-point and dynamic variable arrays are supported.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] path The path to the file. If it exists, it's overwritten.
  * \retval int
- * \arg If successful, returns the amount of storage space that got deallocated.
+ * \arg If successful, returns non-zero.
  * \arg Otherwise, returns zero.
  */
-int DynarrTrim (struct DynamicArray* sarray)
+int DynarrSave (struct DynamicArray* sarray, const char* path)
 {
-    if (sarray->Capacity == sarray->Count)
-        return 0;
-
-    int freed = 0;
-    void* tempPointer = realloc(sarray->Array, sarray->Count * sarray->TypeSize);
-
-    if (tempPointer)
+    struct __DynarrSaveHeader header = { .ByteOrder = __DYNARR_BYTE_ORDER, .Version = __DYNARR_SAVE_VERSION };
+    struct __DynarrChecksum checksum;
+    struct DynamicVariable* element;
+    size_t counter;
+    uint16_t type;
+    uint32_t size;
+    int success = 1;
+    FILE* file;
+
+    if (__Dyn_SizeOf(sarray->Type) == 0 && sarray->Type != Var)
     {
-        freed = sarray->Capacity - sarray->Count;
-        sarray->Array = tempPointer;
-        sarray->Capacity = sarray->Count;
+        fprintf(stderr, "Error: only integer, floating-point and dynamic variable arrays can be saved.\n");
+        return 0;
     }
-    else
+    else if (!(file = fopen(path, "wb")))
     {
-        fprintf(stderr, "Error: failed to trim down the dynamic array.\n");
+        fprintf(stderr, "Error: failed to create the file to save the dynamic array to.\n");
+        return 0;
     }
 
-    return freed;
-}
-
-/** \brief Expands the memory space allocated to the specified DynamicArray.
- *
- * \param[out] sarray Pointer to a DynamicArray.
- * \param[in] addSpace Defines how many extra elements the array should be able to store.
- * \return \c void
- */
-void DynarrExpand (struct DynamicArray* sarray, int addSpace)
-{
-    if (addSpace <= 0 || sarray->Type == 0)
-        return;
+    memcpy(header.Magic, __DYNARR_SAVE_MAGIC, sizeof(header.Magic));
+    header.Type = sarray->Type;
+    header.TypeSize = sarray->TypeSize;
+    header.Count = sarray->Count;
+    header.Sorted = sarray->Sorted;
+    __Dynarr_ChecksumStart(&checksum);
 
-    void* tempPointer = realloc(sarray->Array, sarray->TypeSize * (sarray->Count + addSpace));
+    // Reserve the space of the header. It's written again once the checksum is known
+    success = fwrite(&header, sizeof(header), 1, file) == 1;
 
-    if (tempPointer)
+    if (sarray->Type != Var)
     {
-        sarray->Array = tempPointer;
-        sarray->Capacity += addSpace;
+        __Dynarr_ChecksumUpdate(&checksum, sarray->Array, sarray->Count * sarray->TypeSize);
+        success = success && fwrite(sarray->Array, sarray->TypeSize, sarray->Count, file) == sarray->Count;
     }
     else
     {
-        fprintf(stderr, "Error: failed to expand the dynamic array.\n");
+        for (counter = 0; success && counter < sarray->Count; counter++)
+        {
+            element = (Dynvar*)sarray->Array + counter;
+            type = element->Type;
+            size = element->Size;
+
+            __Dynarr_ChecksumUpdate(&checksum, &type, sizeof(type));
+            __Dynarr_ChecksumUpdate(&checksum, &size, sizeof(size));
+            __Dynarr_ChecksumUpdate(&checksum, element->Data, size);
+
+            success = fwrite(&type, sizeof(type), 1, file) == 1
+                && fwrite(&size, sizeof(size), 1, file) == 1
+                && fwrite(element->Data, 1, size, file) == size;
+        }
+    }
+
+    header.DataSize = checksum.Length;
+    header.Checksum = __Dynarr_ChecksumFinish(&checksum);
+
+    success = success
+        && fseek(file, 0, SEEK_SET) == 0
+        && fwrite(&header, sizeof(header), 1, file) == 1;
+
+    if (fclose(file) != 0 || !success)
+    {
+        fprintf(stderr, "Error: failed to save the dynamic array.\n");
+        return 0;
     }
+
+    return 1;
 }
 
-/** \brief Returns a sub-array from a DynamicArray within the range defined by <i>min</i> and <i>max</i>.
- *
- * \param[in] sarray Pointer to a DynamicArray to create a sub-array from.
- * \param[in] min,max Defines index range from which elements should be taken from.
+/** \brief Loads a DynamicArray from a file written by DynarrSave().
+ * \details The checksum of the file is verified. Files saved by machines with a different byte order
+ * are converted, except for arrays of dynamic variables.
+ * \param[in] path The path to the file.
  * \retval struct DynamicArray
- * \arg If successful, returns a DynamicArray that contains a sub-array of <i>sarray</i>.
+ * \arg If successful, returns a DynamicArray with the elements stored in the file.
  * \arg Otherwise, returns a DynamicArray with a null array.
  */
-struct DynamicArray DynarrGetSubarray (struct DynamicArray* sarray, int min, int max)
+struct DynamicArray DynarrLoad (const char* path)
 {
-    if (min < 0 || max < 0) // If range is below 0, return a null array
+    struct DynamicArray sarray = { 0 };
+    struct __DynarrSaveHeader header;
+    struct __DynarrChecksum checksum;
+    struct DynamicVariable element;
+    size_t counter;
+    uint16_t type;
+    uint32_t size;
+    int swapped, success = 1;
+    FILE* file;
+
+    if (!(file = fopen(path, "rb")))
     {
-        fprintf(stderr, "Error: invalid index range.\n");
-        return NewDynamicArray(0, 0);
+        fprintf(stderr, "Error: failed to open the file to load the dynamic array from.\n");
+        return sarray;
     }
-    else if (min > max)     // If min is greater than max, swap them
+    else if (!(swapped = __Dynarr_ReadSaveHeader(&header, file)) || (swapped > 1 && header.Type == Var))
     {
-        min ^= max;
-        max ^= min;
-        min ^= max;
+        fprintf(stderr, "Error: the file does not contain a dynamic array that can be loaded.\n");
+        fclose(file);
+        return sarray;
     }
 
-    // If max is greater than the array size, set it to the biggest index of the array
-    if(max > sarray->Count - 1)
-        max = sarray->Count - 1;
+    sarray = NewDynamicArray(header.Count, header.Type);
+    __Dynarr_ChecksumStart(&checksum);
+
+    if (!sarray.Array)
+    {
+        fclose(file);
+        return sarray;
+    }
+    else if (header.Type != Var)
+    {
+        success = fread(sarray.Array, sarray.TypeSize, header.Count, file) == header.Count;
+        sarray.Count = header.Count;
+        __Dynarr_ChecksumUpdate(&checksum, sarray.Array, sarray.Count * sarray.TypeSize);
 
-    // Instantiate a DynamicArray with enough space to store the values in the range
-    struct DynamicArray subArray = NewDynamicArray(max - min + 1, sarray->Type);
+        if (swapped > 1)
+            __Dynarr_SwapBytes(sarray.Array, sarray.Count, sarray.TypeSize);
+    }
+    else
+    {
+        for (counter = 0; success && counter < header.Count; counter++)
+        {
+            element = (struct DynamicVariable)NewDynvar();
 
-    // Add elements within the range to the DynamicArray
-    while (min <= max)
-        DynarrAdd(&subArray, sarray->Array + (sarray->TypeSize * min++));
+            success = fread(&type, sizeof(type), 1, file) == 1
+                && fread(&size, sizeof(size), 1, file) == 1
+                && size <= UINT16_MAX && (element.Data = malloc(size ? size : 1))
+                && fread(element.Data, 1, size, file) == size;
 
-    return subArray;
+            element.Type = type;
+            element.Size = size;
+
+            __Dynarr_ChecksumUpdate(&checksum, &type, sizeof(type));
+            __Dynarr_ChecksumUpdate(&checksum, &size, sizeof(size));
+            __Dynarr_ChecksumUpdate(&checksum, element.Data, (success) ? size : 0);
+
+            // The array takes ownership of the data, so it's released along with the array on failure
+            if (element.Data)
+                memcpy((Dynvar*)sarray.Array + sarray.Count++, &element, sizeof(element));
+        }
+    }
+
+    // The file must end exactly where the elements end and their checksum must match
+    success = success && fgetc(file) == EOF && checksum.Length == header.DataSize
+        && __Dynarr_ChecksumFinish(&checksum) == header.Checksum;
+
+    fclose(file);
+
+    if (!success)
+    {
+        fprintf(stderr, "Error: the file of the dynamic array is truncated or corrupted.\n");
+        DynarrClear(&sarray);
+        return sarray;
+    }
+
+    sarray.Sorted = header.Sorted;
+
+    return sarray;
 }
 
-/** \brief Returns a sub-array from a DynamicArray specified by the <i>compar</i> function.
- * \remark <u>This function may yield incorrect results for floating-point data types, if
- * your <i>compar</i> function performs mathematical operations on them before they are
- * cast to an integer type.</u>
- * \param[in] sarray Pointer to a DynamicArray to create a sub-array from.
- * \param[in] compar
- * \parblock
- * Pointer to a function that takes a void pointer as parameter and returns an \c int.
- * <br> The void pointer represents an element in the DynamicArray.
- * <br> The function must return zero for <u>false</u> evaluations and non-zero values for <u>true</u> evaluations.
- * \endparblock
+/** \brief Loads a DynamicArray from a file written by DynarrSave(), by mapping the file into memory.
+ * \details The elements are not copied or even read until they are accessed, so the array is ready
+ * immediately. The mapping is private: changes to the array never reach the file. The array is moved
+ * to the heap the first time its capacity changes. Everything else works just like with any other array.
+ * \remark Files of dynamic variables, files saved by machines with a different byte order and platforms
+ * other than Linux fall back to DynarrLoad().
+ * \param[in] path The path to the file.
+ * \param[in] verify Non-zero to verify the checksum of the file, which requires reading all of it.
  * \retval struct DynamicArray
- * \arg If successful, returns a DynamicArray that contains a sub-array from <i>sarray</i>.
- * \arg Otherwise, returns an empty DynamicArray of the same type as <i>sarray</i>.
+ * \arg If successful, returns a DynamicArray with the elements stored in the file.
+ * \arg Otherwise, returns a DynamicArray with a null array.
  */
-struct DynamicArray DynarrGetSubarrayCustom (struct DynamicArray* sarray, int (*compar)(const void*))
+struct DynamicArray DynarrLoadMapped (const char* path, int verify)
 {
-    int counter;
-    struct DynamicArray subArray = NewDynamicArray(10, sarray->Type);
+    #ifdef __DYNARR_MMAP
+        struct DynamicArray sarray = { 0 };
+        struct __DynarrSaveHeader header;
+        struct __DynarrChecksum checksum;
+        struct stat status;
+        size_t length;
+        void* mapping;
+        FILE* file;
+
+        if (!(file = fopen(path, "rb")))
+        {
+            fprintf(stderr, "Error: failed to open the file to load the dynamic array from.\n");
+            return sarray;
+        }
+        else if (__Dynarr_ReadSaveHeader(&header, file) != 1 || header.Type == Var)
+        {
+            fclose(file);
+            return DynarrLoad(path);
+        }
 
-    // Cycle through the array and fetch only the values that meet the compar criteria
-    for (counter = 0; counter < sarray->Count; counter++)
-    {
-        if (compar(sarray->Array + (sarray->TypeSize * counter)))
-            DynarrAdd(&subArray, sarray->Array + (sarray->TypeSize * counter));
-    }
+        length = sizeof(header) + header.DataSize;
 
-    // If sub-array is bigger than it should, trim it down.
-    if (subArray.Count != subArray.Capacity)
-        DynarrTrim(&subArray);
+        // Accessing a mapping past the end of its file crashes the program, so the size has to match
+        if (fstat(fileno(file), &status) != 0 || (uint64_t)status.st_size != length)
+        {
+            fprintf(stderr, "Error: the file of the dynamic array is truncated or corrupted.\n");
+            fclose(file);
+            return sarray;
+        }
 
-    return subArray;
+        mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(file), 0);
+        fclose(file);
+
+        if (mapping == MAP_FAILED)
+        {
+            fprintf(stderr, "Error: failed to map the file of the dynamic array.\n");
+            return sarray;
+        }
+
+        sarray.Array = mapping + sizeof(header);
+        sarray.Capacity = header.Count;
+        sarray.Count = header.Count;
+        sarray.TypeSize = header.TypeSize;
+        sarray.Type = header.Type;
+        sarray.Sorted = header.Sorted;
+        sarray.Storage = DynCopyOnWrite;
+
+        if (verify)
+        {
+            __Dynarr_ChecksumStart(&checksum);
+            __Dynarr_ChecksumUpdate(&checksum, sarray.Array, header.DataSize);
+
+            if (__Dynarr_ChecksumFinish(&checksum) != header.Checksum)
+            {
+                fprintf(stderr, "Error: the file of the dynamic array is corrupted.\n");
+                DynarrClear(&sarray);
+            }
+        }
+
+        return sarray;
+    #else
+        (void)verify;
+        return DynarrLoad(path);
+    #endif // __DYNARR_MMAP
 }
 
-/** \brief Sorts a DynamicArray in ascending order.
+/** \brief Adds an element to a DynamicArray.
  *
  * \param[out] sarray Pointer to a DynamicArray.
- * \return void
+ * \param[in] newElement Pointer to the element to be added.
+ * \retval size_t
+ * \arg If successful, returns the amount of elements contained in the array.
+ * \arg Otherwise, returns zero.
  */
-void DynarrSort (struct DynamicArray* sarray)
+size_t DynarrAdd (struct DynamicArray* sarray, void* newElement)
 {
-    __Dynarr_SortArray(sarray, __Dynarr_CompareByType);
+    if (sarray->Type == 0)
+    {
+        fprintf(stderr, "Error: attempted to add an element to a null dynamic array.\n");
+        return 0;
+    }
+
+    // If count is going to exceed the capacity, expand the capacity
+    if (!__Dynarr_Grow(sarray, sarray->Count + 1))
+    {
+        fprintf(stderr, "Error: failed to add an element to the dynamic array.\n");
+        return 0;
+    }
+
+    sarray->Count++;
+
+    // Add the new element to the end of the array
+    __Dynarr_CopyElements(sarray, sarray->Array + sarray->TypeSize * (sarray->Count - 1), newElement, 1);
+
+    __Dynarr_UpdateOrder(sarray, sarray->Count - 1, 1);
+
+    return sarray->Count;
 }
 
-/** \brief Sorts a DynamicArray in descending order.
+/** \brief Inserts all elements of a DynamicArray into another DynamicArray at the specified index.
  *
- * \param[out] sarray Pointer to a DynamicArray.
- * \return \c void
+ * \param[in] source Pointer to a DynamicArray to be copied from.
+ * \param[out] target Pointer to a DynamicArray that will receive the elements.
+ * \param[in] targetIndex Index at <i>target</i> where the new elements will be inserted to.
+ * \retval size_t
+ * \arg If successful, returns the starting index where the old elements of <i>target</i> have been moved to.
+ * \arg Otherwise, returns zero.
  */
-void DynarrSortDesc (struct DynamicArray* sarray)
+size_t DynarrInsert (struct DynamicArray* source, struct DynamicArray* target, size_t targetIndex)
 {
-    __Dynarr_SortArray(sarray, __Dynarr_CompareByTypeDesc);
+    if (!__Dynarr_SameType(source, target))
+    {
+        fprintf(stderr, "Error: the dynamic arrays don't store data of the same type.\n");
+        return 0;
+    }
+
+    return DynarrInsertArray(source->Array, target, source->Count, targetIndex, source->Type);
 }
 
-/** \brief Sorts a DynamicArray in the order specified by the <i>compar</i> function.
- * \remark <u>This function may yield incorrect results for floating-point data types, if
- * your <i>compar</i> function performs mathematical operations on them before they are cast
- * to an integer type.</u>
- * \param[out] sarray: Pointer to a DynamicArray.
- * \param[in] compar
- * \parblock
- * Pointer to a function that compares two values and returns an \c int that is:
- * <br> <u>Less than zero</u>, if first value is going to be placed before the second value.
- * <br> <u>Zero</u>, if both values are to remain side by side.
- * <br> <u>Greater than zero</u>, if first value is going to be placed after the second value.
- * \endparblock
- * \return \c void
+/** \brief Inserts one new element into a DynamicArray at the specified index.
+ *
+ * \param[in] source Pointer to the data to be copied from.
+ * \param[out] target Pointer to a DynamicArray that will receive the element.
+ * \param[in] targetIndex Index at <i>target</i> where the new element will be inserted to.
+ * \param[in] DType The type of data to be inserted.
+ * \retval size_t
+ * \arg If successful, returns the starting index where the old elements of <i>target</i> have been moved to.
+ * \arg Otherwise, returns zero.
  */
-void DynarrSortCustom (struct DynamicArray* sarray, int (*compar)(const void*, const void*))
+size_t DynarrInsertElem (void* source, struct DynamicArray* target, size_t targetIndex, enum DataType DType)
 {
-    qsort(sarray->Array, sarray->Count, sarray->TypeSize, compar);
+    return DynarrInsertArray(source, target, 1, targetIndex, DType);
 }
 
-/** \brief Prints the elements stored in a DynamicArray and its properties.
- *
- * \param[in] sarray Pointer to a DynamicArray.
- * \param[in] delimiter A string to be placed between the elements of the
- * array when they are printed to \c stdout.
- * \return \c void
+/** \brief Inserts all elements of a collection into a DynamicArray at the specified index.
+ * \details The collection is copied as a single block. Dynamic variables are deep copied, so the
+ * DynamicArray never shares their data with the collection.
+ * \param[in] source Pointer to the collection of data to be inserted.
+ * \param[out] target Pointer to a DynamicArray that will receive the data.
+ * \param[in] sourceAmount Amount of elements to be added.
+ * \param[in] targetIndex Index at <i>target</i> where the new elements will be inserted to.
+ * \param[in] DType The type of data to be inserted.
+ * \retval size_t
+ * \arg If successful, returns the starting index where the old elements of <i>target</i> have been moved to.
+ * \arg Otherwise, returns zero.
  */
-void DynarrPrintAll (struct DynamicArray* sarray, char* delimiter)
+size_t DynarrInsertArray (void* source, struct DynamicArray* target, size_t sourceAmount, size_t targetIndex, enum DataType DType)
 {
-    // Print the elements
-    printf("Elements: ");
-    DynarrPrint(sarray, delimiter);
+    void* overlap = NULL;
 
-    // Print the properties
-    printf("\nCount: %d\n", sarray->Count);
-    printf("Capacity: %d\n", sarray->Capacity);
-    #ifdef DEBUG
-    printf("Type: %d\n", sarray->Type);             // Debug
-    printf("Type Size: %d\n", sarray->TypeSize);    // Debug
-    #endif
-    printf("Array Size: %d bytes\n\n", sarray->Capacity * sarray->TypeSize);
+    if (target->Type == 0 || target->TypeSize == 0)
+    {
+        fprintf(stderr, "Error: the dynamic array has not been initialized.\n");
+        return 0;
+    }
+    else if (DType != target->Type)
+    {
+        fprintf(stderr, "Error: the dynamic arrays don't store data of the same type.\n");
+        return 0;
+    }
+    else if (sourceAmount > SIZE_MAX / target->TypeSize - target->Count)
+    {
+        fprintf(stderr, "Error: the collection is too big to fit in the dynamic array.\n");
+        return 0;
+    }
+    else if (targetIndex > target->Count) targetIndex = target->Count;
+
+    // If the collection is stored in the target itself, it's going to be moved around, so copy it beforehand
+    if (sourceAmount && source >= target->Array && source < target->Array + (target->Count * target->TypeSize))
+    {
+        if (!(overlap = __Dynarr_Allocate(target->Alignment, sourceAmount * target->TypeSize)))
+        {
+            fprintf(stderr, "Error: failed to add a collection to the dynamic array.\n");
+            return 0;
+        }
+
+        source = memcpy(overlap, source, sourceAmount * target->TypeSize);
+    }
+
+    // Allocate extra memory if the insertion is going to exceed the current space
+    if (!__Dynarr_Grow(target, target->Count + sourceAmount))
+    {
+        fprintf(stderr, "Error: failed to add a collection to the dynamic array.\n");
+        __Dynarr_FreeBuffer(target->Alignment, overlap);
+        return 0;
+    }
+
+    // Copy old data to its new location in the same array
+    // Think of the array as 3 distinct areas: index 0 to targetIndex, sourceAmount and the leftovers to the right (total - tIndex - sAmount)
+    memmove(
+        target->Array + ((targetIndex + sourceAmount) * target->TypeSize),  // Destination: one index after the last index the source is going to use
+        target->Array + (targetIndex * target->TypeSize),                   // Source: starts from the element at the specified index
+        (target->Count - targetIndex) * target->TypeSize                    // Copy all elements located to the right of the specified index
+    );
+
+    // Copy new data from source to the target
+    // Dynamic variables and custom elements with a copy function are deep copied, so they don't share their data with the source
+    __Dynarr_CopyElements(target, target->Array + (targetIndex * target->TypeSize), source, sourceAmount);
+    __Dynarr_FreeBuffer(target->Alignment, overlap);
+
+    // Update the count on the target
+    target->Count += sourceAmount;
+    __Dynarr_UpdateOrder(target, targetIndex, sourceAmount);
+
+    return targetIndex + sourceAmount;
 }
 
-/** \brief Gets the element stored in a DynamicArray at the specified index.
- * \remark It silently quits if the provided index is out of range.
- * \param[in] sarray Pointer to a DynamicArray.
- * \param[in] index The index the specified element is located at.
- * \retval void*
- * \arg If successful, a void pointer to the element at the specified index.
- * \arg Otherwise, a null pointer.
+/** \brief Inserts one new element into a sorted DynamicArray, at the position that keeps it sorted.
+ * \details The position is found with a binary search. If there are elements equivalent to the new one,
+ * it's placed after them.
+ * \remark The array must have been sorted by DynarrSort() or DynarrSortDesc().
+ * \param[out] sarray Pointer to a sorted DynamicArray.
+ * \param[in] newElement Pointer to the element to be inserted.
+ * \retval size_t
+ * \arg If successful, returns the amount of elements contained in the array.
+ * \arg Otherwise, returns zero.
  */
-void* DynarrGetElement(struct DynamicArray* sarray, int index)
+size_t DynarrInsertSorted (struct DynamicArray* sarray, void* newElement)
 {
-    if (index >= sarray->Count || index < 0)
-        return NULL;
+    if (sarray->Sorted == DynUnsorted)
+    {
+        fprintf(stderr, "Error: attempted to insert an element in order into an unsorted dynamic array.\n");
+        return 0;
+    }
 
-    return sarray->Array + (sarray->TypeSize * index);
+    return DynarrInsertArray(newElement, sarray, 1, __Dynarr_Bound(sarray, newElement, 1), sarray->Type) ? sarray->Count : 0;
 }
 
-/** \brief Changes the element stored in a DynamicArray at the specified index.
- * \remark It silently quits if the provided index is out of range.
- * \param[in] sarray Pointer to a DynamicArray.
- * \param[out] element Pointer to the new value.
- * \param[in] index The index where the new element will be inserted.
+/** \brief Adds all elements from <i>source</i> to <i>target</i>.
+ * \details The space is reserved once and the elements are copied as a single block.
+ * Dynamic variables are deep copied.
+ * \param[in] source Pointer to a DynamicArray to have its data copied from.
+ * \param[out] target Pointer to a DynamicArray to have data copied to.
  * \return \c void
  */
-void DynarrSetElement(struct DynamicArray* sarray, void* element, int index)
+void DynarrJoin (struct DynamicArray* source, struct DynamicArray* target)
 {
-    if (index >= sarray->Count || index < 0)
+    if (!__Dynarr_SameType(source, target) || source->Count == 0)
         return;
 
-    memcpy(sarray->Array + (index * sarray->TypeSize), element, sarray->TypeSize);
+    DynarrInsertArray(source->Array, target, source->Count, target->Count, source->Type);
 }
 
-/** \brief Prints the elements stored in a DynamicArray.
- *
- * \param[in] sarray Pointer to a DynamicArray.
- * \param[in] delimiter A string to be placed between the elements of the
- * array when they are printed to \c stdout.
+/** \brief Moves all elements from <i>source</i> to the end of <i>target</i>, leaving <i>source</i> empty.
+ * \details If <i>target</i> is empty, the arrays just swap their buffers and nothing is copied.
+ * Otherwise, the elements are copied as a single block, but the data of dynamic variables is
+ * handed over instead of being copied.
+ * \param[out] source Pointer to a DynamicArray to have its elements moved from.
+ * \param[out] target Pointer to a DynamicArray to have the elements moved to.
  * \return \c void
  */
-void DynarrPrint (struct DynamicArray* sarray, char* delimiter)
+void DynarrJoinMove (struct DynamicArray* source, struct DynamicArray* target)
 {
-    int counter;
+    void* buffer = target->Array;
+    size_t capacity = target->Capacity;
 
-    switch (sarray->Type)
+    if (!__Dynarr_SameType(source, target) || source->Count == 0 || source == target)
+        return;
+
+    if (target->Count == 0 && source->Storage == DynHeap && target->Storage == DynHeap && source->Alignment == target->Alignment)
     {
-        case Char:
+        // Hand the buffer of the source over to the target and give the source the empty buffer
+        target->Array = source->Array;
+        target->Capacity = source->Capacity;
+        target->Count = source->Count;
+        target->Sorted = source->Sorted;
+
+        source->Array = buffer;
+        source->Capacity = capacity;
+    }
+    else
+    {
+        if (!__Dynarr_Grow(target, target->Count + source->Count))
+        {
+            fprintf(stderr, "Error: failed to move the elements to the dynamic array.\n");
+            return;
+        }
+
+        memcpy(target->Array + (target->Count * target->TypeSize), source->Array, source->Count * source->TypeSize);
+        target->Count += source->Count;
+        __Dynarr_UpdateOrder(target, target->Count - source->Count, source->Count);
+    }
+
+    source->Count = 0;
+}
+
+/** \brief Returns the index of the specified data in the DynamicArray,
+ * if there is one.
+ * \remark Elements are matched by their bytes, using SIMD instructions where available.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \retval ptrdiff_t
+ * \arg Returns the index of the first element that matched the
+ * specified data.
+ * \arg If the data is not found in the array, returns -1.
+ */
+ptrdiff_t DynarrIndexOf (struct DynamicArray* sarray, void* element)
+{
+    size_t index = __Dynarr_Search(sarray, element, __DynarrFindFirst);
+
+    // Return -1 if data is not found in the array
+    return (index == sarray->Count) ? -1 : (ptrdiff_t)index;
+}
+
+/** \brief Returns the index of the last occurrence of the specified data in the DynamicArray,
+ * if there is one.
+ * \remark Elements are matched by their bytes, using SIMD instructions where available.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \retval ptrdiff_t
+ * \arg Returns the index of the last element that matched the
+ * specified data.
+ * \arg If the data is not found in the array, returns -1.
+ */
+ptrdiff_t DynarrLastIndexOf (struct DynamicArray* sarray, void* element)
+{
+    size_t index = __Dynarr_Search(sarray, element, __DynarrFindLast);
+
+    // Return -1 if data is not found in the array
+    return (index == sarray->Count) ? -1 : (ptrdiff_t)index;
+}
+
+/** \brief Checks if the specified data is stored in the DynamicArray.
+ * \remark Elements are matched by their bytes, using SIMD instructions where available.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \retval int
+ * \arg Returns non-zero if the data is found in the array.
+ * \arg Otherwise, returns zero.
+ */
+int DynarrContains (struct DynamicArray* sarray, void* element)
+{
+    return __Dynarr_Search(sarray, element, __DynarrFindFirst) != sarray->Count;
+}
+
+/** \brief Counts how many times the specified data is stored in the DynamicArray.
+ * \remark Elements are matched by their bytes, using SIMD instructions where available.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \retval size_t
+ * \arg Returns the amount of elements that matched the specified data.
+ */
+size_t DynarrCount (struct DynamicArray* sarray, void* element)
+{
+    return __Dynarr_Search(sarray, element, __DynarrFindCount);
+}
+
+/** \brief Returns the index of the specified data in a sorted DynamicArray, if there is one.
+ * \details If the array has been sorted by DynarrSort() or DynarrSortDesc(), the element is found with a
+ * binary search in logarithmic time. Otherwise, this function falls back to DynarrIndexOf().
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \retval ptrdiff_t
+ * \arg Returns the index of the first element that is equivalent to the specified data.
+ * \arg If the data is not found in the array, returns -1.
+ */
+ptrdiff_t DynarrBinarySearch (struct DynamicArray* sarray, void* element)
+{
+    size_t index;
+
+    if (sarray->Sorted == DynUnsorted)
+        return DynarrIndexOf(sarray, element);
+
+    index = __Dynarr_Bound(sarray, element, 0);
+
+    // The lower bound is the first element that is not ordered before the data
+    if (index == sarray->Count || __Dynarr_CompareOrder(sarray, sarray->Array + (sarray->TypeSize * index), element) != 0)
+        return -1;
+
+    return (ptrdiff_t)index;
+}
+
+/** \brief Returns the index of the first element of a sorted DynamicArray that is not ordered before the specified data.
+ * \remark The array must have been sorted by DynarrSort() or DynarrSortDesc().
+ * \param[in] sarray Pointer to a sorted DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \retval ptrdiff_t
+ * \arg If successful, returns the first index where the data could be inserted without breaking the order
+ * of the array. If all elements are ordered before the data, that's the amount of elements in the array.
+ * \arg If the array is not sorted, returns -1.
+ */
+ptrdiff_t DynarrLowerBound (struct DynamicArray* sarray, void* element)
+{
+    if (sarray->Sorted == DynUnsorted)
+    {
+        fprintf(stderr, "Error: attempted to perform a binary search on an unsorted dynamic array.\n");
+        return -1;
+    }
+
+    return (ptrdiff_t)__Dynarr_Bound(sarray, element, 0);
+}
+
+/** \brief Returns the index of the first element of a sorted DynamicArray that is ordered after the specified data.
+ * \remark The array must have been sorted by DynarrSort() or DynarrSortDesc().
+ * \param[in] sarray Pointer to a sorted DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \retval ptrdiff_t
+ * \arg If successful, returns the last index where the data could be inserted without breaking the order
+ * of the array. If no element is ordered after the data, that's the amount of elements in the array.
+ * \arg If the array is not sorted, returns -1.
+ */
+ptrdiff_t DynarrUpperBound (struct DynamicArray* sarray, void* element)
+{
+    if (sarray->Sorted == DynUnsorted)
+    {
+        fprintf(stderr, "Error: attempted to perform a binary search on an unsorted dynamic array.\n");
+        return -1;
+    }
+
+    return (ptrdiff_t)__Dynarr_Bound(sarray, element, 1);
+}
+
+/** \brief Deallocates the memory from the array of a DynamicArray and resets all its properties.
+ *
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \return \c void
+ */
+void DynarrClear (struct DynamicArray* sarray)
+{
+    // If the elements own any resources, release them first
+    __Dynarr_ReleaseElements(sarray, 0, sarray->Count);
+
+    // Deallocate the array, or unmap it if it's stored in a file. Inline buffers have nothing to release
+    if (sarray->Storage == DynHeap)
+        __Dynarr_FreeBuffer(sarray->Alignment, sarray->Array);
+    else if (sarray->Storage != DynInline)
+        __Dynarr_Unmap(sarray);
+
+    // Reset everything
+    sarray->Array = NULL;
+    sarray->Capacity = 0;
+    sarray->Count = 0;
+    sarray->Type = 0;
+    sarray->TypeSize = 0;
+    sarray->Sorted = DynUnsorted;
+    sarray->Growth = (struct DynarrGrowth){ 0 };
+    sarray->Alignment = 0;
+    sarray->Custom = NULL;
+    sarray->Storage = DynHeap;
+}
+
+/** \brief Removes an element from a DynamicArray at the specified index.
+ * \details This function basically shifts the entire array starting from the provided index.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] index Index of the element to be removed.
+ * \retval size_t
+ * \arg If successful, returns the amount of elements that got shifted.
+ * \arg Otherwise, returns zero.
+ */
+size_t DynarrRemove (struct DynamicArray* sarray, size_t index)
+{
+    if (index >= sarray->Count)
+    {
+        fprintf(stderr, "Error: index out of range.\n");
+        return 0;
+    }
+
+    // Remove the element at the specified index
+    return __Dynarr_RemoveRange(sarray, index, 1);
+}
+
+/** \brief Removes a range of contiguous elements from a DynamicArray.
+ * \details All elements after the range are shifted with a single block move.
+ * \remark If the range exceeds the end of the array, it's truncated to it.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] first Index of the first element to be removed.
+ * \param[in] amount Amount of elements to be removed.
+ * \retval size_t
+ * \arg If successful, returns the amount of elements that got removed.
+ * \arg Otherwise, returns zero.
+ */
+size_t DynarrRemoveRange (struct DynamicArray* sarray, size_t first, size_t amount)
+{
+    if (first >= sarray->Count)
+    {
+        fprintf(stderr, "Error: index out of range.\n");
+        return 0;
+    }
+    else if (amount > sarray->Count - first)
+    {
+        amount = sarray->Count - first;
+    }
+
+    __Dynarr_RemoveRange(sarray, first, amount);
+
+    return amount;
+}
+
+/** \brief Removes the elements at the specified indices from a DynamicArray.
+ * \details The gaps are closed in a single pass, so every remaining element is moved at most once.
+ * \remark Indices that are out of range or repeated are ignored.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] sortedIndices Pointer to an array of indices, sorted in ascending order.
+ * \param[in] amount Amount of indices in <i>sortedIndices</i>.
+ * \retval size_t
+ * \arg Returns the amount of elements that got removed.
+ */
+size_t DynarrRemoveIndices (struct DynamicArray* sarray, const size_t* sortedIndices, size_t amount)
+{
+    size_t counter, index, write, runStart, removed = 0;
+
+    // Skip straight to the first element that is going to be removed
+    for (counter = 0; counter < amount && sortedIndices[counter] >= sarray->Count; counter++);
+
+    if (counter == amount)
+        return 0;
+
+    write = runStart = sortedIndices[counter];
+
+    for (; counter < amount; counter++)
+    {
+        index = sortedIndices[counter];
+
+        // Ignore indices that are out of range, unsorted or repeated
+        if (index >= sarray->Count || index < runStart)
+            continue;
+
+        // Move the run of kept elements that precedes this index to its final position
+        memmove(sarray->Array + (write * sarray->TypeSize), sarray->Array + (runStart * sarray->TypeSize), (index - runStart) * sarray->TypeSize);
+        write += index - runStart;
+        runStart = index + 1;
+        removed++;
+
+        __Dynarr_ReleaseElements(sarray, index, 1);
+    }
+
+    // Move the remaining elements
+    memmove(sarray->Array + (write * sarray->TypeSize), sarray->Array + (runStart * sarray->TypeSize), (sarray->Count - runStart) * sarray->TypeSize);
+    sarray->Count -= removed;
+
+    return removed;
+}
+
+/** \brief Removes all elements specified by the <i>compar</i> function from a DynamicArray.
+ * \details The array is compacted in a single pass, so every remaining element is moved at most once.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] compar
+ * \parblock
+ * Pointer to a function that takes a void pointer as parameter and returns an \c int.
+ * <br> The void pointer represents an element in the DynamicArray.
+ * <br> The function must return zero for <u>false</u> evaluations and non-zero values for <u>true</u> evaluations.
+ * \endparblock
+ * \retval size_t
+ * \arg Returns the amount of elements that got removed.
+ */
+size_t DynarrRemoveCustom (struct DynamicArray* sarray, int (*compar)(const void*))
+{
+    return __Dynarr_Compact(sarray, compar, 1);
+}
+
+/** \brief Removes all elements from a DynamicArray, except the ones specified by the <i>compar</i> function.
+ * \details The array is compacted in a single pass, so every remaining element is moved at most once.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] compar
+ * \parblock
+ * Pointer to a function that takes a void pointer as parameter and returns an \c int.
+ * <br> The void pointer represents an element in the DynamicArray.
+ * <br> The function must return zero for <u>false</u> evaluations and non-zero values for <u>true</u> evaluations.
+ * \endparblock
+ * \retval size_t
+ * \arg Returns the amount of elements that got removed.
+ */
+size_t DynarrRetainCustom (struct DynamicArray* sarray, int (*compar)(const void*))
+{
+    return __Dynarr_Compact(sarray, compar, 0);
+}
+
+/** \brief Removes all elements of a DynamicArray that satisfy the comparison against <i>value</i>.
+ * \remark Only integer and floating-point arrays are supported. The comparisons are evaluated in
+ * blocks that the compiler can vectorize, so this is considerably faster than DynarrRemoveCustom().
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] comparison How each element is compared to <i>value</i>. E.g. \c DynLess removes elements smaller than <i>value</i>.
+ * \param[in] value Pointer to a value of the same type as the elements of the array.
+ * \retval size_t
+ * \arg Returns the amount of elements that got removed.
+ */
+size_t DynarrRemoveWhere (struct DynamicArray* sarray, enum DynarrComparison comparison, void* value)
+{
+    return __Dynarr_CompactWhere(sarray, comparison, value, 1);
+}
+
+/** \brief Removes all elements of a DynamicArray, except the ones that satisfy the comparison against <i>value</i>.
+ * \remark Only integer and floating-point arrays are supported. The comparisons are evaluated in
+ * blocks that the compiler can vectorize, so this is considerably faster than DynarrRetainCustom().
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] comparison How each element is compared to <i>value</i>. E.g. \c DynLess keeps elements smaller than <i>value</i>.
+ * \param[in] value Pointer to a value of the same type as the elements of the array.
+ * \retval size_t
+ * \arg Returns the amount of elements that got removed.
+ */
+size_t DynarrRetainWhere (struct DynamicArray* sarray, enum DynarrComparison comparison, void* value)
+{
+    return __Dynarr_CompactWhere(sarray, comparison, value, 0);
+}
+
+/** \brief Deallocates unused memory from a DynamicArray.
+ * \remark Multiply the return value by the size of the data type to get the amount of bytes released.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \retval size_t
+ * \arg If successful, returns the amount of storage space that got deallocated.
+ * \arg Otherwise, returns zero.
+ */
+size_t DynarrTrim (struct DynamicArray* sarray)
+{
+    if (sarray->Capacity == sarray->Count)
+        return 0;
+
+    size_t freed = sarray->Capacity - sarray->Count;
+
+    if (!__Dynarr_Resize(sarray, sarray->Count))
+    {
+        fprintf(stderr, "Error: failed to trim down the dynamic array.\n");
+        return 0;
+    }
+
+    return freed;
+}
+
+/** \brief Expands the memory space allocated to the specified DynamicArray.
+ *
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] addSpace Defines how many extra elements the array should be able to store.
+ * \return \c void
+ */
+void DynarrExpand (struct DynamicArray* sarray, size_t addSpace)
+{
+    if (addSpace == 0 || sarray->Type == 0 || sarray->TypeSize == 0)
+        return;
+    else if (addSpace > SIZE_MAX / sarray->TypeSize - sarray->Capacity)
+    {
+        fprintf(stderr, "Error: failed to expand the dynamic array.\n");
+        return;
+    }
+
+    if (!__Dynarr_Resize(sarray, sarray->Capacity + addSpace))
+        fprintf(stderr, "Error: failed to expand the dynamic array.\n");
+}
+
+/** \brief Ensures a DynamicArray can store the specified amount of extra elements without reallocating.
+ * \details Unlike DynarrExpand(), the array grows according to its growth policy, so reserving
+ * space before each append still costs amortized constant time.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] amount Amount of elements that are going to be added to the array.
+ * \retval size_t
+ * \arg If successful, returns the capacity of the array.
+ * \arg Otherwise, returns zero.
+ */
+size_t DynarrReserve (struct DynamicArray* sarray, size_t amount)
+{
+    if (sarray->Type == 0)
+    {
+        fprintf(stderr, "Error: attempted to reserve space in a null dynamic array.\n");
+        return 0;
+    }
+    else if (amount > SIZE_MAX - sarray->Count || !__Dynarr_Grow(sarray, sarray->Count + amount))
+    {
+        fprintf(stderr, "Error: failed to reserve space in the dynamic array.\n");
+        return 0;
+    }
+
+    return sarray->Capacity;
+}
+
+/** \brief Changes how a DynamicArray grows when it runs out of storage space.
+ *
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] factor The capacity is multiplied by this value when the array grows. Must be greater than 1.
+ * \param[in] maxStep Maximum amount of elements added to the capacity at once, or zero for no limit.
+ * \param[in] rounding
+ * \parblock
+ * Buffers of at least this many bytes are rounded up to a multiple of it, or zero for no rounding.
+ * <br> Use \c DYNARR_PAGE_SIZE or \c DYNARR_HUGE_PAGE_SIZE to fill whole memory pages.
+ * \endparblock
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynarrSetGrowth (struct DynamicArray* sarray, float factor, size_t maxStep, size_t rounding)
+{
+    if (!(factor > 1))
+    {
+        fprintf(stderr, "Error: the growth factor of a dynamic array must be greater than 1.\n");
+        return 0;
+    }
+
+    sarray->Growth.Factor = factor;
+    sarray->Growth.MaxStep = maxStep;
+    sarray->Growth.Rounding = rounding;
+
+    return 1;
+}
+
+/** \brief Returns a sub-array from a DynamicArray within the range defined by <i>min</i> and <i>max</i>.
+ * \remark The elements are copied as a single block. Use DynarrGetView() to avoid the copy altogether.
+ * \param[in] sarray Pointer to a DynamicArray to create a sub-array from.
+ * \param[in] min,max Defines index range from which elements should be taken from.
+ * \retval struct DynamicArray
+ * \arg If successful, returns a DynamicArray that contains a sub-array of <i>sarray</i>.
+ * \arg Otherwise, returns a DynamicArray with a null array.
+ */
+struct DynamicArray DynarrGetSubarray (struct DynamicArray* sarray, size_t min, size_t max)
+{
+    if (min > max)  // If min is greater than max, swap them
+    {
+        min ^= max;
+        max ^= min;
+        min ^= max;
+    }
+
+    // If the range starts past the end of the array, return an empty array
+    if (min >= sarray->Count)
+        return __Dynarr_NewLike(sarray, 0);
+
+    // If max is greater than the array size, set it to the biggest index of the array
+    if (max > sarray->Count - 1)
+        max = sarray->Count - 1;
+
+    struct DynarrView view = DynarrGetView(sarray, min, max - min + 1, 1);
+
+    return DynarrViewMaterialize(&view);
+}
+
+/** \brief Returns a sub-array from a DynamicArray specified by the <i>compar</i> function.
+ * \remark <u>This function may yield incorrect results for floating-point data types, if
+ * your <i>compar</i> function performs mathematical operations on them before they are
+ * cast to an integer type.</u>
+ * \param[in] sarray Pointer to a DynamicArray to create a sub-array from.
+ * \param[in] compar
+ * \parblock
+ * Pointer to a function that takes a void pointer as parameter and returns an \c int.
+ * <br> The void pointer represents an element in the DynamicArray.
+ * <br> The function must return zero for <u>false</u> evaluations and non-zero values for <u>true</u> evaluations.
+ * \endparblock
+ * \retval struct DynamicArray
+ * \arg If successful, returns a DynamicArray that contains a sub-array from <i>sarray</i>.
+ * \arg Otherwise, returns an empty DynamicArray of the same type as <i>sarray</i>.
+ */
+struct DynamicArray DynarrGetSubarrayCustom (struct DynamicArray* sarray, int (*compar)(const void*))
+{
+    size_t counter;
+    struct DynamicArray subArray = __Dynarr_NewLike(sarray, 10);
+
+    // The elements keep their relative order
+    subArray.Sorted = sarray->Sorted;
+
+    // Cycle through the array and fetch only the values that meet the compar criteria
+    for (counter = 0; counter < sarray->Count; counter++)
+    {
+        if (compar(sarray->Array + (sarray->TypeSize * counter)))
+            DynarrAdd(&subArray, sarray->Array + (sarray->TypeSize * counter));
+    }
+
+    // If sub-array is bigger than it should, trim it down.
+    if (subArray.Count != subArray.Capacity)
+        DynarrTrim(&subArray);
+
+    return subArray;
+}
+
+/** \brief Creates a view of a range of elements of a DynamicArray, without copying them.
+ * \details The view selects <i>count</i> elements, starting at <i>offset</i> and <i>stride</i> elements
+ * apart from each other. It refers to <i>sarray</i> itself, so it stays valid when <i>sarray</i> grows,
+ * and changes to the elements are seen through it.
+ * \remark The range is truncated to the end of the array.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] offset Index of the first element of the view.
+ * \param[in] count Amount of elements of the view.
+ * \param[in] stride Distance between two consecutive elements of the view. One selects adjacent elements, zero is treated as one.
+ * \retval struct DynarrView
+ * \arg Returns a DynarrView of the range. If the range starts past the end of the array, the view is empty.
+ */
+struct DynarrView DynarrGetView (struct DynamicArray* sarray, size_t offset, size_t count, size_t stride)
+{
+    struct DynarrView view = { .Base = sarray, .Offset = offset, .Count = 0, .Stride = (stride) ? stride : 1 };
+
+    // Only take the elements that exist in the array
+    if (offset < sarray->Count && count > 0)
+    {
+        size_t available = (sarray->Count - offset - 1) / view.Stride + 1;
+        view.Count = (count < available) ? count : available;
+    }
+
+    return view;
+}
+
+/** \brief Gets the element of a DynarrView at the specified index.
+ *
+ * \param[in] view Pointer to a DynarrView.
+ * \param[in] index The index of the element in the view.
+ * \retval void*
+ * \arg If successful, a void pointer to the element at the specified index.
+ * \arg Otherwise, a null pointer.
+ */
+void* DynarrViewGetElement (struct DynarrView* view, size_t index)
+{
+    return (index < view->Count)
+        ? DynarrGetElement(view->Base, view->Offset + (index * view->Stride))
+        : NULL;
+}
+
+/** \brief Copies the elements of a DynarrView into a new DynamicArray.
+ * \remark Dynamic variables are deep copied.
+ * \param[in] view Pointer to a DynarrView.
+ * \retval struct DynamicArray
+ * \arg If successful, returns a DynamicArray that contains the elements of the view.
+ * \arg Otherwise, returns a DynamicArray with a null array.
+ */
+struct DynamicArray DynarrViewMaterialize (struct DynarrView* view)
+{
+    struct DynamicArray window, copy = __Dynarr_NewLike(view->Base, view->Count);
+    size_t counter, run = (view->Stride == 1) ? view->Count : 1;
+
+    if (!copy.Array || view->Count == 0 || !__Dynarr_CheckView(view))
+        return copy;
+
+    // Adjacent elements are copied as a single block, the others one by one
+    for (counter = 0; counter < view->Count; counter += run)
+    {
+        window = __Dynarr_ViewWindow(view, counter, run);
+        __Dynarr_CopyElements(&copy, copy.Array + (counter * copy.TypeSize), window.Array, run);
+    }
+
+    copy.Count = view->Count;
+
+    // Any subsequence of a sorted array is sorted in the same order
+    copy.Sorted = view->Base->Sorted;
+
+    return copy;
+}
+
+/** \brief Returns the index of the specified data in a DynarrView, if there is one.
+ * \remark Elements are matched by their bytes, just like in DynarrIndexOf().
+ * \param[in] view Pointer to a DynarrView.
+ * \param[in] element The data to be searched for.
+ * \retval ptrdiff_t
+ * \arg Returns the index in the view of the first element that matched the specified data.
+ * \arg If the data is not found in the view, returns -1.
+ */
+ptrdiff_t DynarrViewIndexOf (struct DynarrView* view, void* element)
+{
+    struct DynamicArray window;
+    size_t counter;
+
+    if (!__Dynarr_CheckView(view))
+        return -1;
+
+    // Adjacent elements can be searched with SIMD instructions
+    if (view->Stride == 1)
+    {
+        window = __Dynarr_ViewWindow(view, 0, view->Count);
+        return DynarrIndexOf(&window, element);
+    }
+
+    for (counter = 0; counter < view->Count; counter++)
+    {
+        if (__Dynarr_Matches(view->Base, DynarrViewGetElement(view, counter), element))
+            return (ptrdiff_t)counter;
+    }
+
+    return -1;
+}
+
+/** \brief Prints the elements of a DynarrView.
+ *
+ * \param[in] view Pointer to a DynarrView.
+ * \param[in] delimiter A string to be placed between the elements of the
+ * view when they are printed to \c stdout.
+ * \return \c void
+ */
+void DynarrViewPrint (struct DynarrView* view, char* delimiter)
+{
+    struct DynamicArray window;
+    size_t counter, run = (view->Stride == 1) ? view->Count : 1;
+
+    if (!__Dynarr_CheckView(view))
+        return;
+
+    // Adjacent elements are printed all at once, the others one by one
+    for (counter = 0; counter < view->Count; counter += run)
+    {
+        window = __Dynarr_ViewWindow(view, counter, run);
+        DynarrPrint(&window, delimiter);
+    }
+}
+
+/** \brief Sorts the elements of a DynarrView in ascending order, in place.
+ * \remark Only views of adjacent elements (with a stride of one) can be sorted. The elements outside
+ * the view are not moved.
+ * \param[out] view Pointer to a DynarrView.
+ * \return \c void
+ */
+void DynarrViewSort (struct DynarrView* view)
+{
+    __Dynarr_SortView(view, 0);
+}
+
+/** \brief Sorts the elements of a DynarrView in descending order, in place.
+ * \remark Only views of adjacent elements (with a stride of one) can be sorted. The elements outside
+ * the view are not moved.
+ * \param[out] view Pointer to a DynarrView.
+ * \return \c void
+ */
+void DynarrViewSortDesc (struct DynarrView* view)
+{
+    __Dynarr_SortView(view, 1);
+}
+
+/** \brief Adds up all elements of a numeric DynarrView.
+ * \remark The elements are read in place, however far apart they are.
+ * \param[in] view Pointer to a DynarrView.
+ * \param[out] result Pointer to the variable that will receive the sum. See DynarrSum() for its type.
+ * \param[in] summation The summation algorithm to be used.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynarrViewSum (struct DynarrView* view, void* result, enum DynarrSummation summation)
+{
+    return __Dynarr_CheckView(view) && __Dynarr_Reduce(view, __DynarrSum, result, summation);
+}
+
+/** \brief Calculates the arithmetic mean of the elements of a numeric DynarrView.
+ *
+ * \param[in] view Pointer to a DynarrView.
+ * \retval double
+ * \arg If successful, returns the mean of the elements.
+ * \arg Otherwise, returns zero.
+ */
+double DynarrViewMean (struct DynarrView* view)
+{
+    return (__Dynarr_CheckView(view)) ? __Dynarr_Mean(view) : 0;
+}
+
+/** \brief Returns the index of the smallest element of a numeric DynarrView.
+ * \remark It works the same as DynarrArgMin(), NaNs included.
+ * \param[in] view Pointer to a DynarrView.
+ * \retval ptrdiff_t
+ * \arg If successful, returns the index in the view of the smallest element.
+ * \arg If the view is empty or not numeric, returns -1.
+ */
+ptrdiff_t DynarrViewArgMin (struct DynarrView* view)
+{
+    size_t index;
+    return (__Dynarr_CheckView(view) && __Dynarr_Reduce(view, __DynarrArgMin, &index, DynSumSimple)) ? (ptrdiff_t)index : -1;
+}
+
+/** \brief Returns the index of the biggest element of a numeric DynarrView.
+ * \remark It works the same as DynarrArgMax(), NaNs included.
+ * \param[in] view Pointer to a DynarrView.
+ * \retval ptrdiff_t
+ * \arg If successful, returns the index in the view of the biggest element.
+ * \arg If the view is empty or not numeric, returns -1.
+ */
+ptrdiff_t DynarrViewArgMax (struct DynarrView* view)
+{
+    size_t index;
+    return (__Dynarr_CheckView(view) && __Dynarr_Reduce(view, __DynarrArgMax, &index, DynSumSimple)) ? (ptrdiff_t)index : -1;
+}
+
+/** \brief Sorts a DynamicArray in ascending order.
+ * \remark Large integer and floating-point arrays are radix sorted. Different arrays can be sorted concurrently.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \return void
+ */
+void DynarrSort (struct DynamicArray* sarray)
+{
+    __Dynarr_SortArray(sarray, 0);
+}
+
+/** \brief Sorts a DynamicArray in descending order.
+ * \remark Large integer and floating-point arrays are radix sorted. Different arrays can be sorted concurrently.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \return \c void
+ */
+void DynarrSortDesc (struct DynamicArray* sarray)
+{
+    __Dynarr_SortArray(sarray, 1);
+}
+
+/** \brief Sorts a DynamicArray in the order specified by the <i>compar</i> function.
+ * \remark <u>This function may yield incorrect results for floating-point data types, if
+ * your <i>compar</i> function performs mathematical operations on them before they are cast
+ * to an integer type.</u>
+ * \param[out] sarray: Pointer to a DynamicArray.
+ * \param[in] compar
+ * \parblock
+ * Pointer to a function that compares two values and returns an \c int that is:
+ * <br> <u>Less than zero</u>, if first value is going to be placed before the second value.
+ * <br> <u>Zero</u>, if both values are to remain side by side.
+ * <br> <u>Greater than zero</u>, if first value is going to be placed after the second value.
+ * \endparblock
+ * \return \c void
+ */
+void DynarrSortCustom (struct DynamicArray* sarray, int (*compar)(const void*, const void*))
+{
+    qsort(sarray->Array, sarray->Count, sarray->TypeSize, compar);
+
+    // The order defined by compar can't be used by the binary searches
+    sarray->Sorted = DynUnsorted;
+}
+
+/** \brief Sorts a DynamicArray in ascending order, using multiple threads.
+ * \details The array is split into <i>threads</i> chunks, which are sorted concurrently by the threads of
+ * the pool (see DynarrPoolStart()) and then merged in parallel. Arrays smaller than \c DYNARR_PARALLEL_THRESHOLD are sorted by DynarrSort().
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] threads The amount of chunks the array is split into, usually the amount of threads to be used.
+ * \return \c void
+ */
+void DynarrSortParallel (struct DynamicArray* sarray, size_t threads)
+{
+    __Dynarr_SortParallel(sarray, threads, 0, NULL);
+}
+
+/** \brief Sorts a DynamicArray in descending order, using multiple threads.
+ * \details The array is split into <i>threads</i> chunks, which are sorted concurrently by the threads of
+ * the pool (see DynarrPoolStart()) and then merged in parallel. Arrays smaller than \c DYNARR_PARALLEL_THRESHOLD are sorted by DynarrSortDesc().
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] threads The amount of chunks the array is split into, usually the amount of threads to be used.
+ * \return \c void
+ */
+void DynarrSortDescParallel (struct DynamicArray* sarray, size_t threads)
+{
+    __Dynarr_SortParallel(sarray, threads, 1, NULL);
+}
+
+/** \brief Sorts a DynamicArray in the order specified by the <i>compar</i> function, using multiple threads.
+ * \details The array is split into <i>threads</i> chunks, which are sorted concurrently by the threads of
+ * the pool (see DynarrPoolStart()) and then merged in parallel. Arrays smaller than \c DYNARR_PARALLEL_THRESHOLD are sorted by DynarrSortCustom().
+ * \warning <i>compar</i> is called from multiple threads at the same time.
+ * \param[out] sarray: Pointer to a DynamicArray.
+ * \param[in] compar
+ * \parblock
+ * Pointer to a function that compares two values and returns an \c int that is:
+ * <br> <u>Less than zero</u>, if first value is going to be placed before the second value.
+ * <br> <u>Zero</u>, if both values are to remain side by side.
+ * <br> <u>Greater than zero</u>, if first value is going to be placed after the second value.
+ * \endparblock
+ * \param[in] threads The amount of chunks the array is split into, usually the amount of threads to be used.
+ * \return \c void
+ */
+void DynarrSortCustomParallel (struct DynamicArray* sarray, int (*compar)(const void*, const void*), size_t threads)
+{
+    __Dynarr_SortParallel(sarray, threads, 0, compar);
+}
+
+/** \brief Starts the pool of threads used by the parallel traversals and sorts of DynamicArrays.
+ * \details The threads are kept alive and reused by every traversal. Calling this function is optional:
+ * the first traversal starts the pool with one thread per processor. If the pool is already running,
+ * it's restarted with the new amount of threads.
+ * \warning It must not be called from inside of a parallel traversal.
+ * \param[in] threads The amount of threads that work on each traversal, including the calling thread.
+ * Zero for one per processor.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero and traversals run on the calling thread.
+ */
+int DynarrPoolStart (size_t threads)
+{
+    int success;
+
+    pthread_mutex_lock(&__Dynarr_Pool.submit);
+    __Dynarr_PoolDestroy();
+    success = (threads == 1) || __Dynarr_PoolCreate(threads);
+    pthread_mutex_unlock(&__Dynarr_Pool.submit);
+
+    return success;
+}
+
+/** \brief Stops the pool of threads used by the parallel traversals of DynamicArrays.
+ * \details Waits for the current traversal to finish, if any. The next traversal starts the pool again.
+ * \warning It must not be called from inside of a parallel traversal.
+ * \return \c void
+ */
+void DynarrPoolStop (void)
+{
+    pthread_mutex_lock(&__Dynarr_Pool.submit);
+    __Dynarr_PoolDestroy();
+    pthread_mutex_unlock(&__Dynarr_Pool.submit);
+}
+
+/** \brief Applies a function to every element of a DynamicArray, using multiple threads.
+ * \details The array is split into grains of <i>grain</i> elements, which are shared among the threads
+ * of the pool. Threads that run out of grains steal them from the others. The elements are visited
+ * in no particular order.
+ * \warning <i>action</i> is called from multiple threads at the same time. It may modify the element
+ * it receives, but must not add or remove elements from the array.
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] action Pointer to a function that takes a pointer to an element and <i>context</i>.
+ * \param[in] context A pointer passed to <i>action</i>. Can be NULL.
+ * \param[in] grain The amount of elements each thread processes at a time. Zero for <b>DYNARR_PARALLEL_GRAIN</b>.
+ * \return \c void
+ */
+void DynarrParallelForEach (struct DynamicArray* sarray, void (*action)(void*, void*), void* context, size_t grain)
+{
+    struct __DynarrParallelJob job = { .sarray = sarray, .body = __Dynarr_ForEachRange, .action = action, .context = context };
+
+    __Dynarr_SplitGrains(&job, sarray->Count, grain);
+    __Dynarr_RunParallel(&job);
+
+    // The elements may have been modified
+    sarray->Sorted = DynUnsorted;
+}
+
+/** \brief Transforms every element of a DynamicArray into an element of another one, using multiple threads.
+ * \details The elements of <i>target</i> are replaced by as many elements as <i>source</i> has, and the
+ * element at each index of <i>target</i> is produced from the element at the same index of <i>source</i>.
+ * The arrays can be of different types.
+ * \warning <i>transform</i> is called from multiple threads at the same time. It receives uninitialized
+ * memory, so it must write the whole element. Dynamic variables must be created from scratch.
+ * \param[in] source Pointer to a DynamicArray to have its elements transformed.
+ * \param[out] target Pointer to a DynamicArray that will receive the transformed elements. It can't be <i>source</i>.
+ * \param[in] transform Pointer to a function that takes a pointer to the element of <i>target</i>, a pointer
+ * to the element of <i>source</i> and <i>context</i>.
+ * \param[in] context A pointer passed to <i>transform</i>. Can be NULL.
+ * \param[in] grain The amount of elements each thread processes at a time. Zero for <b>DYNARR_PARALLEL_GRAIN</b>.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero and <i>target</i> is left untouched.
+ */
+int DynarrParallelMap (struct DynamicArray* source, struct DynamicArray* target, void (*transform)(void*, const void*, void*), void* context, size_t grain)
+{
+    struct __DynarrParallelJob job = { .sarray = source, .target = target, .body = __Dynarr_MapRange, .transform = transform, .context = context };
+
+    if (source == target || !target->Array)
+    {
+        fprintf(stderr, "Error: the elements must be mapped to another dynamic array.\n");
+        return 0;
+    }
+    else if (!__Dynarr_Grow(target, source->Count))
+    {
+        fprintf(stderr, "Error: failed to allocate memory for the mapped elements.\n");
+        return 0;
+    }
+
+    __Dynarr_ReleaseElements(target, 0, target->Count);
+    target->Count = 0;
+
+    __Dynarr_SplitGrains(&job, source->Count, grain);
+    __Dynarr_RunParallel(&job);
+
+    target->Count = source->Count;
+    target->Sorted = DynUnsorted;
+
+    return 1;
+}
+
+/** \brief Returns a sub-array with the elements of a DynamicArray that meet a condition, using multiple threads.
+ * \details This is the parallel counterpart of DynarrGetSubarrayCustom(). The condition is evaluated
+ * on all grains concurrently, then the accepted elements are copied concurrently, keeping their order.
+ * \warning <i>predicate</i> is called from multiple threads at the same time.
+ * \param[in] sarray Pointer to a DynamicArray to create a sub-array from.
+ * \param[in] predicate
+ * \parblock
+ * Pointer to a function that takes a void pointer as parameter and returns an \c int.
+ * <br> The void pointer represents an element in the DynamicArray.
+ * <br> The function must return zero for <u>false</u> evaluations and non-zero values for <u>true</u> evaluations.
+ * \endparblock
+ * \param[in] grain The amount of elements each thread processes at a time. Zero for <b>DYNARR_PARALLEL_GRAIN</b>.
+ * \retval struct DynamicArray
+ * \arg If successful, returns a DynamicArray that contains a sub-array from <i>sarray</i>.
+ * \arg Otherwise, returns an empty DynamicArray of the same type as <i>sarray</i>.
+ */
+struct DynamicArray DynarrParallelFilter (struct DynamicArray* sarray, int (*predicate)(const void*), size_t grain)
+{
+    struct __DynarrParallelJob job = { .sarray = sarray, .body = __Dynarr_SelectRange, .predicate = predicate };
+    struct DynamicArray subArray;
+    size_t counter, total = 0, accepted;
+
+    __Dynarr_SplitGrains(&job, sarray->Count, grain);
+    job.selected = malloc(sarray->Count ? sarray->Count : 1);
+    job.offsets = malloc((job.grains ? job.grains : 1) * sizeof(size_t));
+
+    // Fall back to the serial filter
+    if (!job.selected || !job.offsets)
+    {
+        free(job.selected);
+        free(job.offsets);
+
+        return DynarrGetSubarrayCustom(sarray, predicate);
+    }
+
+    __Dynarr_RunParallel(&job);
+
+    // Turn the amount of accepted elements of each grain into the index of its first one
+    for (counter = 0; counter < job.grains; counter++)
+    {
+        accepted = job.offsets[counter];
+        job.offsets[counter] = total;
+        total += accepted;
+    }
+
+    subArray = __Dynarr_NewLike(sarray, total);
+
+    if (subArray.Array && total > 0)
+    {
+        job.target = &subArray;
+        job.body = __Dynarr_GatherRange;
+        __Dynarr_RunParallel(&job);
+
+        subArray.Count = total;
+    }
+
+    // The elements keep their relative order
+    subArray.Sorted = sarray->Sorted;
+
+    free(job.selected);
+    free(job.offsets);
+
+    return subArray;
+}
+
+/** \brief Initializes an object of type DynarrConcurrent according to the specified data type.
+ * \details No memory is allocated until the first element is added.
+ * \remark Only integer, floating-point, dynamic variable and pointer types are supported.
+ * \param[in] DType The data type of the elements to be stored in the array.
+ * \retval struct DynarrConcurrent
+ * \arg If successful, returns an empty DynarrConcurrent.
+ * \arg Otherwise, returns a DynarrConcurrent with no type.
+ */
+struct DynarrConcurrent NewDynarrConcurrent (enum DataType DType)
+{
+    struct DynarrConcurrent carray = { .Type = DType, .TypeSize = __Dynarr_ElementSize(DType) };
+
+    if (carray.TypeSize == 0)
+    {
+        fprintf(stderr, "Error: unrecognized type. A null array was generated.\n");
+        carray.Type = 0;
+    }
+
+    return carray;
+}
+
+/** \brief Adds an element to the end of a DynarrConcurrent. Can be called by many threads at the same time.
+ * \details Dynamic variables are deep copied.
+ * \param[out] carray Pointer to a DynarrConcurrent.
+ * \param[in] newElement Pointer to the element to be added.
+ * \retval size_t
+ * \arg If successful, returns the index of the new element plus one.
+ * \arg Otherwise, returns zero.
+ */
+size_t DynarrConcurrentAdd (struct DynarrConcurrent* carray, void* newElement)
+{
+    return DynarrConcurrentAddArray(carray, newElement, 1);
+}
+
+/** \brief Adds multiple elements to the end of a DynarrConcurrent. Can be called by many threads at the same time.
+ * \details The slots of all elements are claimed with a single atomic operation, so they are consecutive.
+ * The elements are published as soon as they and all elements before them have been written. Dynamic
+ * variables are deep copied.
+ * \remark If memory for the elements can't be allocated, their slots are left empty, so the elements
+ * added after them are still published. Empty slots are skipped by DynarrConcurrentGet() and
+ * DynarrConcurrentToDynarr().
+ * \param[out] carray Pointer to a DynarrConcurrent.
+ * \param[in] source Pointer to an array with the elements to be added.
+ * \param[in] amount The amount of elements to be added.
+ * \retval size_t
+ * \arg If successful, returns the index of the last new element plus one.
+ * \arg Otherwise, returns zero.
+ */
+size_t DynarrConcurrentAddArray (struct DynarrConcurrent* carray, void* source, size_t amount)
+{
+    struct DynamicArray model = { .Type = carray->Type, .TypeSize = carray->TypeSize };
+    size_t first, counter;
+    unsigned char* ready;
+    int allocated;
+    void* slot;
+
+    if (carray->Type == 0)
+    {
+        fprintf(stderr, "Error: attempted to add an element to a null dynamic array.\n");
+        return 0;
+    }
+    else if (amount == 0)
+    {
+        return 0;
+    }
+    else if (amount > SIZE_MAX / carray->TypeSize)
+    {
+        fprintf(stderr, "Error: the collection is too big to fit in the dynamic array.\n");
+        return 0;
+    }
+
+    first = __atomic_fetch_add(&carray->Reserved, amount, __ATOMIC_ACQ_REL);
+
+    // The segments are allocated before anything is written, so the elements are either all added or
+    // all left empty. Either way, their slots are resolved and the elements after them can be published.
+    allocated = __Dynarr_ConcurrentAllocate(carray, first, amount);
+
+    for (counter = 0; counter < amount; counter++)
+    {
+        // The slots of segments that couldn't be allocated are empty already
+        if (!(slot = __Dynarr_ConcurrentSlot(carray, first + counter, &ready)))
+            continue;
+
+        if (allocated)
+            __Dynarr_CopyElements(&model, slot, source + (counter * carray->TypeSize), 1);
+
+        __atomic_store_n(ready, (allocated) ? __DYNARR_SLOT_WRITTEN : __DYNARR_SLOT_EMPTY, __ATOMIC_RELEASE);
+    }
+
+    __Dynarr_ConcurrentPublish(carray);
+
+    if (!allocated)
+    {
+        fprintf(stderr, "Error: failed to allocate memory for the dynamic array.\n");
+        return 0;
+    }
+
+    return first + amount;
+}
+
+/** \brief Returns the amount of published elements of a DynarrConcurrent.
+ * \details All elements before the returned amount are completely written or left empty, and can be read without locks.
+ * \param[in] carray Pointer to a DynarrConcurrent.
+ * \retval size_t
+ * \arg Returns the amount of elements visible to readers.
+ */
+size_t DynarrConcurrentCount (struct DynarrConcurrent* carray)
+{
+    return __atomic_load_n(&carray->Published, __ATOMIC_ACQUIRE);
+}
+
+/** \brief Returns a pointer to a published element of a DynarrConcurrent.
+ * \details The elements are never moved, so the pointer stays valid until the array is cleared.
+ * \param[in] carray Pointer to a DynarrConcurrent.
+ * \param[in] index Index of the element.
+ * \retval void*
+ * \arg If the element has been published, returns a pointer to it.
+ * \arg If it hasn't or its slot was left empty by a failed addition, returns NULL.
+ */
+void* DynarrConcurrentGet (struct DynarrConcurrent* carray, size_t index)
+{
+    unsigned char* ready;
+    void* slot;
+
+    if (index >= DynarrConcurrentCount(carray))
+    {
+        #ifdef _WIN32
+            __mingw_fprintf(stderr, "Error: index %zu is out of bounds.\n", index);
+        #else
+            fprintf(stderr, "Error: index %zu is out of bounds.\n", index);
+        #endif // _WIN32
+        return NULL;
+    }
+
+    // Published slots are never written again, so their flags can be read directly
+    if (!(slot = __Dynarr_ConcurrentSlot(carray, index, &ready)) || *ready != __DYNARR_SLOT_WRITTEN)
+        return NULL;
+
+    return slot;
+}
+
+/** \brief Copies the published elements of a DynarrConcurrent to a new DynamicArray.
+ * \details Each run of consecutive elements is copied as a single block. Empty slots are skipped. Dynamic
+ * variables are deep copied.
+ * \param[in] carray Pointer to a DynarrConcurrent.
+ * \retval struct DynamicArray
+ * \arg If successful, returns a DynamicArray with the published elements.
+ * \arg Otherwise, returns a DynamicArray with a null array.
+ */
+struct DynamicArray DynarrConcurrentToDynarr (struct DynarrConcurrent* carray)
+{
+    size_t count = DynarrConcurrentCount(carray), index, length, used, first, last, segment;
+    struct DynamicArray sarray = NewDynamicArray(count, carray->Type);
+    unsigned char* buffer;
+
+    for (segment = 0, index = 0; sarray.Array && index < count; segment++, index += length)
+    {
+        length = (size_t)1 << (segment + __DYNARR_SEGMENT_SHIFT);
+        used = (length < count - index) ? length : count - index;
+        buffer = __atomic_load_n(&carray->Segments[segment], __ATOMIC_ACQUIRE);
+
+        // The elements of segments that couldn't be allocated are all empty
+        if (buffer == &__Dynarr_DeadSegment)
+            continue;
+
+        // The flags of the elements follow them
+        for (first = 0; first < used; first = last)
+        {
+            for (last = first; last < used && buffer[(length * carray->TypeSize) + last] == __DYNARR_SLOT_WRITTEN; last++);
+
+            if (last > first && !DynarrInsertArray(buffer + (first * carray->TypeSize), &sarray, last - first, sarray.Count, carray->Type))
+                return sarray;
+
+            for (; last < used && buffer[(length * carray->TypeSize) + last] != __DYNARR_SLOT_WRITTEN; last++);
+        }
+    }
+
+    return sarray;
+}
+
+/** \brief Deallocates the memory of a DynarrConcurrent and resets all its properties.
+ * \warning No other thread may be using the array.
+ * \param[out] carray Pointer to a DynarrConcurrent.
+ * \return \c void
+ */
+void DynarrConcurrentClear (struct DynarrConcurrent* carray)
+{
+    unsigned char* ready;
+    size_t counter, segment;
+    void* slot;
+
+    // Release the dynamic variables that were completely written
+    for (counter = 0; carray->Type == Var && counter < carray->Reserved; counter++)
+    {
+        if ((slot = __Dynarr_ConcurrentSlot(carray, counter, &ready)) && *ready == __DYNARR_SLOT_WRITTEN)
+            DynvarClear(slot);
+    }
+
+    for (segment = 0; segment < sizeof(carray->Segments) / sizeof(carray->Segments[0]); segment++)
+    {
+        if (carray->Segments[segment] != &__Dynarr_DeadSegment)
+            free(carray->Segments[segment]);
+
+        carray->Segments[segment] = NULL;
+    }
+
+    // Reset everything
+    carray->Reserved = 0;
+    carray->Published = 0;
+    carray->TypeSize = 0;
+    carray->Type = 0;
+}
+
+/** \brief Adds up all elements of a numeric DynamicArray.
+ * \details The elements are added in several independent lanes, which lets the compiler use SIMD instructions.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[out] result
+ * \parblock
+ * Pointer to the variable that will receive the sum. Its type depends on the type of the array:
+ * <br> \c long \c long for signed integer types.
+ * <br> \c unsigned \c long \c long for unsigned integer types.
+ * <br> \c double for \c Float and \c Double.
+ * <br> \c long \c double for \c LDouble.
+ * \endparblock
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynarrSum (struct DynamicArray* sarray, void* result)
+{
+    struct DynarrView view = DynarrGetView(sarray, 0, sarray->Count, 1);
+    return __Dynarr_Reduce(&view, __DynarrSum, result, DynSumSimple);
+}
+
+/** \brief Adds up all elements of a numeric DynamicArray with the specified summation algorithm.
+ * \remark The algorithm only matters for floating-point types. \c DynSumPairwise and \c DynSumKahan are
+ * slower than \c DynSumSimple, but accumulate considerably less rounding error on big arrays.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[out] result Pointer to the variable that will receive the sum. See DynarrSum() for its type.
+ * \param[in] summation The summation algorithm to be used.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynarrSumWith (struct DynamicArray* sarray, void* result, enum DynarrSummation summation)
+{
+    struct DynarrView view = DynarrGetView(sarray, 0, sarray->Count, 1);
+    return __Dynarr_Reduce(&view, __DynarrSum, result, summation);
+}
+
+/** \brief Calculates the arithmetic mean of the elements of a numeric DynamicArray.
+ *
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \retval double
+ * \arg If successful, returns the mean of the elements.
+ * \arg Otherwise, returns zero.
+ */
+double DynarrMean (struct DynamicArray* sarray)
+{
+    struct DynarrView view = DynarrGetView(sarray, 0, sarray->Count, 1);
+    return __Dynarr_Mean(&view);
+}
+
+/** \brief Returns the index of the smallest element of a numeric DynamicArray.
+ * \remark If the smallest value occurs more than once, the index of its first occurrence is returned.
+ * NaNs are ignored, unless every element is NaN, in which case 0 is returned.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \retval ptrdiff_t
+ * \arg If successful, returns the index of the smallest element.
+ * \arg If the array is empty or not numeric, returns -1.
+ */
+ptrdiff_t DynarrArgMin (struct DynamicArray* sarray)
+{
+    struct DynarrView view = DynarrGetView(sarray, 0, sarray->Count, 1);
+    size_t index;
+
+    return __Dynarr_Reduce(&view, __DynarrArgMin, &index, DynSumSimple) ? (ptrdiff_t)index : -1;
+}
+
+/** \brief Returns the index of the biggest element of a numeric DynamicArray.
+ * \remark If the biggest value occurs more than once, the index of its first occurrence is returned.
+ * NaNs are ignored, unless every element is NaN, in which case 0 is returned.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \retval ptrdiff_t
+ * \arg If successful, returns the index of the biggest element.
+ * \arg If the array is empty or not numeric, returns -1.
+ */
+ptrdiff_t DynarrArgMax (struct DynamicArray* sarray)
+{
+    struct DynarrView view = DynarrGetView(sarray, 0, sarray->Count, 1);
+    size_t index;
+
+    return __Dynarr_Reduce(&view, __DynarrArgMax, &index, DynSumSimple) ? (ptrdiff_t)index : -1;
+}
+
+/** \brief Gets the smallest element of a numeric DynamicArray.
+ *
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \retval void*
+ * \arg If successful, a void pointer to the smallest element.
+ * \arg If the array is empty or not numeric, a null pointer.
+ */
+void* DynarrMin (struct DynamicArray* sarray)
+{
+    ptrdiff_t index = DynarrArgMin(sarray);
+    return (index < 0) ? NULL : sarray->Array + (sarray->TypeSize * index);
+}
+
+/** \brief Gets the biggest element of a numeric DynamicArray.
+ *
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \retval void*
+ * \arg If successful, a void pointer to the biggest element.
+ * \arg If the array is empty or not numeric, a null pointer.
+ */
+void* DynarrMax (struct DynamicArray* sarray)
+{
+    ptrdiff_t index = DynarrArgMax(sarray);
+    return (index < 0) ? NULL : sarray->Array + (sarray->TypeSize * index);
+}
+
+/** \brief Prints the elements stored in a DynamicArray and its properties.
+ *
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] delimiter A string to be placed between the elements of the
+ * array when they are printed to \c stdout.
+ * \return \c void
+ */
+void DynarrPrintAll (struct DynamicArray* sarray, char* delimiter)
+{
+    // Print the elements
+    printf("Elements: ");
+    DynarrPrint(sarray, delimiter);
+
+    // Print the properties
+    #ifdef _WIN32
+        __mingw_printf("\nCount: %zu\n", sarray->Count);
+        __mingw_printf("Capacity: %zu\n", sarray->Capacity);
+    #else
+        printf("\nCount: %zu\n", sarray->Count);
+        printf("Capacity: %zu\n", sarray->Capacity);
+    #endif // _WIN32
+    #ifdef DEBUG
+    printf("Type: %d\n", sarray->Type);             // Debug
+    printf("Type Size: %d\n", (int)sarray->TypeSize);    // Debug
+    #endif
+    #ifdef _WIN32
+        __mingw_printf("Array Size: %zu bytes\n\n", sarray->Capacity * sarray->TypeSize);
+    #else
+        printf("Array Size: %zu bytes\n\n", sarray->Capacity * sarray->TypeSize);
+    #endif // _WIN32
+}
+
+/** \brief Gets the element stored in a DynamicArray at the specified index.
+ * \remark It silently quits if the provided index is out of range.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] index The index the specified element is located at.
+ * \retval void*
+ * \arg If successful, a void pointer to the element at the specified index.
+ * \arg Otherwise, a null pointer.
+ */
+void* DynarrGetElement(struct DynamicArray* sarray, size_t index)
+{
+    if (index >= sarray->Count)
+        return NULL;
+
+    return sarray->Array + (sarray->TypeSize * index);
+}
+
+/** \brief Changes the element stored in a DynamicArray at the specified index.
+ * \remark It silently quits if the provided index is out of range. Dynamic variables are deep copied.
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[out] element Pointer to the new value.
+ * \param[in] index The index where the new element will be inserted.
+ * \return \c void
+ */
+void DynarrSetElement(struct DynamicArray* sarray, void* element, size_t index)
+{
+    void* target = sarray->Array + (index * sarray->TypeSize);
+
+    if (index >= sarray->Count || element == target)
+        return;
+
+    // Dynamic variables and custom elements release their old data and are deep copied, the rest is copied as is
+    __Dynarr_ReleaseElements(sarray, index, 1);
+    __Dynarr_CopyElements(sarray, target, element, 1);
+
+    __Dynarr_UpdateOrder(sarray, index, 1);
+}
+
+/** \brief Prints the elements stored in a DynamicArray.
+ *
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] delimiter A string to be placed between the elements of the
+ * array when they are printed to \c stdout.
+ * \return \c void
+ */
+void DynarrPrint (struct DynamicArray* sarray, char* delimiter)
+{
+    size_t counter;
+
+    switch (sarray->Type)
+    {
+        case Char:
             for (counter = 0; counter < sarray->Count; counter++)
                 printf("%c%s", ((signed char*)sarray->Array)[counter], delimiter);
             break;
 
-        case Short:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%d%s", ((short*)sarray->Array)[counter], delimiter);
-            break;
+        case Short:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%d%s", ((short*)sarray->Array)[counter], delimiter);
+            break;
+
+        case Int:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%d%s", ((int*)sarray->Array)[counter], delimiter);
+            break;
+
+        case Long:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%ld%s", ((long*)sarray->Array)[counter], delimiter);
+            break;
+
+        case LLong:
+            for (counter = 0; counter < sarray->Count; counter++)
+                #ifdef _WIN32
+                    __mingw_printf("%lld%s", ((long long*)sarray->Array)[counter], delimiter);
+                #else
+                    printf("%lld%s", ((long long*)sarray->Array)[counter], delimiter);
+                #endif // _WIN32
+            break;
+
+        case Float:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%.6g%s", ((float*)sarray->Array)[counter], delimiter);
+            break;
+
+        case Double:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%.15g%s", ((double*)sarray->Array)[counter], delimiter);
+            break;
+
+        case LDouble:
+            for (counter = 0; counter < sarray->Count; counter++)
+                #ifdef _WIN32
+                    __mingw_printf("%.19Lg%s", ((long double*)sarray->Array)[counter], delimiter);
+                #else
+                    printf("%.19Lg%s", ((long double*)sarray->Array)[counter], delimiter);
+                #endif // _WIN32
+            break;
+
+        case UChar:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%c%s", ((unsigned char*)sarray->Array)[counter], delimiter);
+            break;
+
+        case UShort:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%u%s", ((unsigned short*)sarray->Array)[counter], delimiter);
+            break;
+
+        case UInt:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%u%s", ((unsigned int*)sarray->Array)[counter], delimiter);
+            break;
+
+        case ULong:
+            for (counter = 0; counter < sarray->Count; counter++)
+                printf("%lu%s", ((unsigned long*)sarray->Array)[counter], delimiter);
+            break;
+
+        case ULLong:
+            for (counter = 0; counter < sarray->Count; counter++)
+                #ifdef _WIN32
+                    __mingw_printf("%llu%s", ((unsigned long long*)sarray->Array)[counter], delimiter);
+                #else
+                    printf("%llu%s", ((unsigned long long*)sarray->Array)[counter], delimiter);
+                #endif // _WIN32
+            break;
+
+        case Var:
+            for (counter = 0; counter < sarray->Count; counter++)
+                DynvarPrint(&((Dynvar*)sarray->Array)[counter], delimiter);
+            break;
+
+        default:
+            fprintf(stderr, "Error: attempted to print an unsupported data type or the array is null.\n");
+            break;
+    }
+}
+
+
+/* Support Functions */
+
+
+/** \brief This function instantiates a DynamicArray struct of the data type specified by the user.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] elements A number representing how many elements the array should be able to hold.
+ * \param[in] DType An enum representing the desired data type.
+ * \return \c void
+ */
+static void __Dynarr_NewArray (struct DynamicArray* sarray, size_t elements, enum DataType DType)
+{
+    // Instantiate the right type of array
+    switch (DType)
+    {
+        case Char:
+            sarray->Type = Char;
+            sarray->TypeSize = sizeof(signed char);
+            sarray->Array = calloc(elements, sizeof(signed char));
+            break;
+
+        case Short:
+            sarray->Type = Short;
+            sarray->TypeSize = sizeof(short);
+            sarray->Array = calloc(elements, sizeof(short));
+            break;
+
+        case Int:
+            sarray->Type = Int;
+            sarray->TypeSize = sizeof(int);
+            sarray->Array = calloc(elements, sizeof(int));
+            break;
+
+        case Long:
+            sarray->Type = Long;
+            sarray->TypeSize = sizeof(long);
+            sarray->Array = calloc(elements, sizeof(long));
+            break;
+
+        case LLong:
+            sarray->Type = LLong;
+            sarray->TypeSize = sizeof(long long);
+            sarray->Array = calloc(elements, sizeof(long long));
+            break;
+
+        case Float:
+            sarray->Type = Float;
+            sarray->TypeSize = sizeof(float);
+            sarray->Array = calloc(elements, sizeof(float));
+            break;
+
+        case Double:
+            sarray->Type = Double;
+            sarray->TypeSize = sizeof(double);
+            sarray->Array = calloc(elements, sizeof(double));
+            break;
+
+        case LDouble:
+            sarray->Type = LDouble;
+            sarray->TypeSize = sizeof(long double);
+            sarray->Array = calloc(elements, sizeof(long double));
+            break;
+
+        case UChar:
+            sarray->Type = UChar;
+            sarray->TypeSize = sizeof(unsigned char);
+            sarray->Array = calloc(elements, sizeof(unsigned char));
+            break;
+
+        case UShort:
+            sarray->Type = UShort;
+            sarray->TypeSize = sizeof(unsigned short);
+            sarray->Array = calloc(elements, sizeof(unsigned short));
+            break;
+
+        case UInt:
+            sarray->Type = UInt;
+            sarray->TypeSize = sizeof(unsigned int);
+            sarray->Array = calloc(elements, sizeof(unsigned int));
+            break;
+
+        case ULong:
+            sarray->Type = ULong;
+            sarray->TypeSize = sizeof(unsigned long);
+            sarray->Array = calloc(elements, sizeof(unsigned long));
+            break;
+
+        case ULLong:
+            sarray->Type = ULLong;
+            sarray->TypeSize = sizeof(unsigned long long);
+            sarray->Array = calloc(elements, sizeof(unsigned long long));
+            break;
+
+        case Var:
+            sarray->Type = Var;
+            sarray->TypeSize = sizeof(Dynvar);
+            sarray->Array = calloc(elements, sizeof(Dynvar));
+            break;
+
+        case Ptr:
+            sarray->Type = Ptr;
+            sarray->TypeSize = sizeof(void*);
+            sarray->Array = calloc(elements, sizeof(void*));
+            break;
+
+        case Custom:
+            fprintf(stderr, "Error: use NewDynamicArrayCustom() to create arrays of custom data. A null array was generated.\n");
+            sarray->Capacity = 0;
+            sarray->Type = 0;
+            sarray->TypeSize = 0;
+            sarray->Array = NULL;
+            break;
+
+        default:
+            fprintf(stderr, "Error: unrecognized type. A null array was generated.\n");
+            sarray->Capacity = 0;
+            sarray->Type = 0;
+            sarray->TypeSize = 0;
+            sarray->Array = NULL;
+            break;
+    }
+}
+
+/** \brief Grows a DynamicArray according to its growth policy, so it can store at least <i>required</i> elements.
+ * \details The capacity is multiplied by the growth factor, capped by the maximum step, but never less than
+ * <i>required</i>. Large buffers are then rounded up as the policy specifies. If that much memory can't be
+ * allocated, exactly <i>required</i> elements are allocated instead.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] required The amount of elements the array must be able to store.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_Grow (struct DynamicArray* sarray, size_t required)
+{
+    size_t maxCapacity, newCapacity, bytes;
+    double factor = (sarray->Growth.Factor > 1) ? sarray->Growth.Factor : 2;
+
+    if (required <= sarray->Capacity)
+        return 1;
+    else if (sarray->TypeSize == 0)
+        return 0;
+
+    maxCapacity = SIZE_MAX / sarray->TypeSize;
+
+    if (required > maxCapacity)
+        return 0;
+
+    // Grow geometrically, unless that would overflow the addressable space
+    newCapacity = (sarray->Capacity * factor < (double)maxCapacity) ? (size_t)(sarray->Capacity * factor) : maxCapacity;
+
+    if (sarray->Growth.MaxStep && newCapacity - sarray->Capacity > sarray->Growth.MaxStep)
+        newCapacity = sarray->Capacity + sarray->Growth.MaxStep;
+
+    if (newCapacity < required)
+        newCapacity = required;
+
+    // Round large buffers up to a multiple of the rounding
+    bytes = newCapacity * sarray->TypeSize;
+
+    if (sarray->Growth.Rounding && bytes >= sarray->Growth.Rounding && bytes % sarray->Growth.Rounding
+        && bytes <= SIZE_MAX - sarray->Growth.Rounding)
+    {
+        newCapacity = (bytes + sarray->Growth.Rounding - bytes % sarray->Growth.Rounding) / sarray->TypeSize;
+    }
+
+    // If the overshoot can't be allocated, settle for the required space
+    return __Dynarr_Resize(sarray, newCapacity) || (newCapacity > required && __Dynarr_Resize(sarray, required));
+}
+
+/** \brief Removes a range of elements from a DynamicArray.
+ * \remark This is achieved by shifting everything to the right of the range with a single block move.
+ * The data of dynamic variables in the range is released.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] first The index of the first element to be removed. It must be within range.
+ * \param[in] amount The amount of elements to be removed. It must not exceed the end of the array.
+ * \retval size_t
+ * \arg Returns the amount of shifted elements.
+ */
+static size_t __Dynarr_RemoveRange (struct DynamicArray* sarray, size_t first, size_t amount)
+{
+    size_t shifted = sarray->Count - first - amount;
+
+    // Release the resources of the elements that are about to be overwritten
+    __Dynarr_ReleaseElements(sarray, first, amount);
+
+    memmove(
+        sarray->Array + (first * sarray->TypeSize),             // Destination: the first removed element
+        sarray->Array + ((first + amount) * sarray->TypeSize),  // Source: the first element after the range
+        shifted * sarray->TypeSize                              // Move everything up to the end of the array
+    );
+
+    sarray->Count -= amount;
+
+    return shifted;
+}
+
+/** \brief Removes the elements of a DynamicArray according to the <i>compar</i> function, in a single pass.
+ * \remark Kept elements are moved in contiguous runs, so each one of them is written at most once.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] compar Pointer to a function that evaluates an element of the array.
+ * \param[in] removeMatches Non-zero to remove the elements <i>compar</i> evaluates as true, zero to keep them.
+ * \retval size_t
+ * \arg Returns the amount of elements that got removed.
+ */
+static size_t __Dynarr_Compact (struct DynamicArray* sarray, int (*compar)(const void*), int removeMatches)
+{
+    size_t read, write = 0, runStart = 0, removed;
+
+    for (read = 0; read < sarray->Count; read++)
+    {
+        void* element = sarray->Array + (sarray->TypeSize * read);
+
+        // Kept elements just extend the current run
+        if (!!compar(element) != !!removeMatches)
+            continue;
+
+        // Move the run of kept elements that precedes this element to its final position
+        if (write != runStart)
+            memmove(sarray->Array + (sarray->TypeSize * write), sarray->Array + (sarray->TypeSize * runStart), (read - runStart) * sarray->TypeSize);
+
+        write += read - runStart;
+        runStart = read + 1;
+
+        // Release the resources of the removed element
+        __Dynarr_ReleaseElements(sarray, read, 1);
+    }
+
+    // Move the last run
+    if (write != runStart)
+        memmove(sarray->Array + (sarray->TypeSize * write), sarray->Array + (sarray->TypeSize * runStart), (read - runStart) * sarray->TypeSize);
+
+    write += read - runStart;
+    removed = sarray->Count - write;
+    sarray->Count = write;
+
+    return removed;
+}
+
+/** \brief Amount of elements whose comparisons are evaluated together by the typed compaction kernels. */
+#define __DYNARR_BLOCK 256
+
+/** \brief Evaluates <i>first OP second</i> for every element in a block and stores which elements should be kept.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_KEEP_BLOCK(OP)                                         \
+    for (offset = 0; offset < block; offset++)                          \
+        keep[offset] = (array[read + offset] OP value) ^ removeMatches
+
+/** \brief Defines a compaction kernel for a primitive type.
+ * \details The comparisons of each block are branchless and stored in a byte mask, which lets the
+ * compiler vectorize them. Blocks that are entirely kept or removed are skipped without any writes.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ * \param Name The suffix of the generated function.
+ * \param T The primitive type handled by the generated function.
+ */
+#define __DYNARR_DEFINE_COMPACT_WHERE(Name, T)                                                                      \
+static size_t __Dynarr_CompactWhere##Name (T* array, size_t count, enum DynarrComparison comparison, T value, int removeMatches) \
+{                                                                                                                   \
+    unsigned char keep[__DYNARR_BLOCK];                                                                             \
+    size_t read, write = 0, block, offset, kept;                                                                    \
+                                                                                                                    \
+    for (read = 0; read < count; read += block)                                                                     \
+    {                                                                                                               \
+        block = (count - read < __DYNARR_BLOCK) ? count - read : __DYNARR_BLOCK;                                    \
+                                                                                                                    \
+        switch (comparison)                                                                                         \
+        {                                                                                                           \
+            case DynEqual:          __DYNARR_KEEP_BLOCK(==); break;                                                 \
+            case DynNotEqual:       __DYNARR_KEEP_BLOCK(!=); break;                                                 \
+            case DynLess:           __DYNARR_KEEP_BLOCK(<);  break;                                                 \
+            case DynLessEqual:      __DYNARR_KEEP_BLOCK(<=); break;                                                 \
+            case DynGreater:        __DYNARR_KEEP_BLOCK(>);  break;                                                 \
+            case DynGreaterEqual:   __DYNARR_KEEP_BLOCK(>=); break;                                                 \
+            default:                return count;                                                                   \
+        }                                                                                                           \
+                                                                                                                    \
+        for (offset = 0, kept = 0; offset < block; offset++)                                                        \
+            kept += keep[offset];                                                                                   \
+                                                                                                                    \
+        if (kept == block)                                                                                          \
+        {                                                                                                           \
+            /* Whole block is kept, only move it if there's a gap before it */                                      \
+            if (write != read)                                                                                      \
+                memmove(array + write, array + read, block * sizeof(T));                                            \
+                                                                                                                    \
+            write += block;                                                                                         \
+        }                                                                                                           \
+        else if (kept)                                                                                              \
+        {                                                                                                           \
+            for (offset = 0; offset < block; offset++)                                                              \
+            {                                                                                                       \
+                if (keep[offset])                                                                                   \
+                    array[write++] = array[read + offset];                                                          \
+            }                                                                                                       \
+        }                                                                                                           \
+    }                                                                                                               \
+                                                                                                                    \
+    return write;                                                                                                   \
+}
+
+__DYNARR_DEFINE_COMPACT_WHERE(Char, signed char)
+__DYNARR_DEFINE_COMPACT_WHERE(Short, short)
+__DYNARR_DEFINE_COMPACT_WHERE(Int, int)
+__DYNARR_DEFINE_COMPACT_WHERE(Long, long)
+__DYNARR_DEFINE_COMPACT_WHERE(LLong, long long)
+__DYNARR_DEFINE_COMPACT_WHERE(UChar, unsigned char)
+__DYNARR_DEFINE_COMPACT_WHERE(UShort, unsigned short)
+__DYNARR_DEFINE_COMPACT_WHERE(UInt, unsigned int)
+__DYNARR_DEFINE_COMPACT_WHERE(ULong, unsigned long)
+__DYNARR_DEFINE_COMPACT_WHERE(ULLong, unsigned long long)
+__DYNARR_DEFINE_COMPACT_WHERE(Float, float)
+__DYNARR_DEFINE_COMPACT_WHERE(Double, double)
+__DYNARR_DEFINE_COMPACT_WHERE(LDouble, long double)
+
+/** \brief Removes the elements of a primitive DynamicArray according to a comparison against a constant value.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] comparison How each element is compared to <i>value</i>.
+ * \param[in] value Pointer to the value the elements are compared to.
+ * \param[in] removeMatches Non-zero to remove the elements that satisfy the comparison, zero to keep them.
+ * \retval size_t
+ * \arg Returns the amount of elements that got removed.
+ */
+static size_t __Dynarr_CompactWhere (struct DynamicArray* sarray, enum DynarrComparison comparison, void* value, int removeMatches)
+{
+    size_t kept, removed;
+    removeMatches = !!removeMatches;
+
+    if (comparison < DynEqual || comparison > DynGreaterEqual)
+    {
+        fprintf(stderr, "Error: unrecognized comparison.\n");
+        return 0;
+    }
+
+    switch (sarray->Type)
+    {
+        case Char:      kept = __Dynarr_CompactWhereChar(sarray->Array, sarray->Count, comparison, *(signed char*)value, removeMatches); break;
+        case Short:     kept = __Dynarr_CompactWhereShort(sarray->Array, sarray->Count, comparison, *(short*)value, removeMatches); break;
+        case Int:       kept = __Dynarr_CompactWhereInt(sarray->Array, sarray->Count, comparison, *(int*)value, removeMatches); break;
+        case Long:      kept = __Dynarr_CompactWhereLong(sarray->Array, sarray->Count, comparison, *(long*)value, removeMatches); break;
+        case LLong:     kept = __Dynarr_CompactWhereLLong(sarray->Array, sarray->Count, comparison, *(long long*)value, removeMatches); break;
+        case UChar:     kept = __Dynarr_CompactWhereUChar(sarray->Array, sarray->Count, comparison, *(unsigned char*)value, removeMatches); break;
+        case UShort:    kept = __Dynarr_CompactWhereUShort(sarray->Array, sarray->Count, comparison, *(unsigned short*)value, removeMatches); break;
+        case UInt:      kept = __Dynarr_CompactWhereUInt(sarray->Array, sarray->Count, comparison, *(unsigned int*)value, removeMatches); break;
+        case ULong:     kept = __Dynarr_CompactWhereULong(sarray->Array, sarray->Count, comparison, *(unsigned long*)value, removeMatches); break;
+        case ULLong:    kept = __Dynarr_CompactWhereULLong(sarray->Array, sarray->Count, comparison, *(unsigned long long*)value, removeMatches); break;
+        case Float:     kept = __Dynarr_CompactWhereFloat(sarray->Array, sarray->Count, comparison, *(float*)value, removeMatches); break;
+        case Double:    kept = __Dynarr_CompactWhereDouble(sarray->Array, sarray->Count, comparison, *(double*)value, removeMatches); break;
+        case LDouble:   kept = __Dynarr_CompactWhereLDouble(sarray->Array, sarray->Count, comparison, *(long double*)value, removeMatches); break;
+
+        default:
+            fprintf(stderr, "Error: this data type is not supported.\n");
+            return 0;
+    }
+
+    removed = sarray->Count - kept;
+    sarray->Count = kept;
+
+    return removed;
+}
+
+/** \brief Amount of elements below which arrays are sorted by comparison rather than by radix sort. */
+#define __DYNARR_RADIX_THRESHOLD 256
+
+/** \brief Amount of elements below which partitions are sorted by insertion sort. */
+#define __DYNARR_INSERTION_THRESHOLD 16
+
+/* Orderings used by the typed sorting kernels. */
+#define __DYNARR_ASCENDING(first, second) ((first) < (second))
+#define __DYNARR_DESCENDING(first, second) ((first) > (second))
+
+/** \brief Defines an introsort kernel for a primitive type, with inlined comparisons.
+ * \details Partitions are split around a median-of-three pivot until they are small enough for an
+ * insertion sort. If the recursion gets too deep, the partition is heap sorted instead, so the
+ * worst case is O(n log n).
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ * \param Name The suffix of the generated functions.
+ * \param T The primitive type handled by the generated functions.
+ * \param BEFORE A macro that evaluates to true if its first argument should be placed before the second.
+ */
+#define __DYNARR_DEFINE_INTROSORT(Name, T, BEFORE)                                                  \
+static void __Dynarr_InsertionSort##Name (T* array, size_t count)                                   \
+{                                                                                                   \
+    size_t counter, index;                                                                          \
+    T element;                                                                                      \
+                                                                                                    \
+    for (counter = 1; counter < count; counter++)                                                   \
+    {                                                                                               \
+        element = array[counter];                                                                   \
+                                                                                                    \
+        for (index = counter; index > 0 && BEFORE(element, array[index - 1]); index--)              \
+            array[index] = array[index - 1];                                                        \
+                                                                                                    \
+        array[index] = element;                                                                     \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+static void __Dynarr_SiftDown##Name (T* array, size_t root, size_t count)                           \
+{                                                                                                   \
+    size_t child;                                                                                   \
+    T element = array[root];                                                                        \
+                                                                                                    \
+    while ((child = 2 * root + 1) < count)                                                          \
+    {                                                                                               \
+        if (child + 1 < count && BEFORE(array[child], array[child + 1]))                            \
+            child++;                                                                                \
+                                                                                                    \
+        if (!BEFORE(element, array[child]))                                                         \
+            break;                                                                                  \
+                                                                                                    \
+        array[root] = array[child];                                                                 \
+        root = child;                                                                               \
+    }                                                                                               \
+                                                                                                    \
+    array[root] = element;                                                                          \
+}                                                                                                   \
+                                                                                                    \
+static void __Dynarr_HeapSort##Name (T* array, size_t count)                                        \
+{                                                                                                   \
+    size_t counter;                                                                                 \
+    T element;                                                                                      \
+                                                                                                    \
+    for (counter = count / 2; counter-- > 0;)                                                       \
+        __Dynarr_SiftDown##Name(array, counter, count);                                             \
+                                                                                                    \
+    for (counter = count; counter-- > 1;)                                                           \
+    {                                                                                               \
+        element = array[0];                                                                         \
+        array[0] = array[counter];                                                                  \
+        array[counter] = element;                                                                   \
+        __Dynarr_SiftDown##Name(array, 0, counter);                                                 \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+static void __Dynarr_IntroSortLoop##Name (T* array, size_t count, size_t depth)                     \
+{                                                                                                   \
+    ptrdiff_t left, right;                                                                          \
+    T pivot, element;                                                                               \
+                                                                                                    \
+    while (count > __DYNARR_INSERTION_THRESHOLD)                                                    \
+    {                                                                                               \
+        if (depth-- == 0)                                                                           \
+        {                                                                                           \
+            __Dynarr_HeapSort##Name(array, count);                                                  \
+            return;                                                                                 \
+        }                                                                                           \
+                                                                                                    \
+        /* Order the first, middle and last elements, so they work as sentinels */                 \
+        if (BEFORE(array[count / 2], array[0]))                                                     \
+            element = array[0], array[0] = array[count / 2], array[count / 2] = element;            \
+        if (BEFORE(array[count - 1], array[count / 2]))                                             \
+            element = array[count - 1], array[count - 1] = array[count / 2], array[count / 2] = element; \
+        if (BEFORE(array[count / 2], array[0]))                                                     \
+            element = array[0], array[0] = array[count / 2], array[count / 2] = element;            \
+                                                                                                    \
+        /* Hoare partition around the median */                                                     \
+        pivot = array[count / 2];                                                                   \
+        left = -1;                                                                                  \
+        right = count;                                                                              \
+                                                                                                    \
+        for (;;)                                                                                    \
+        {                                                                                           \
+            do left++; while (BEFORE(array[left], pivot));                                          \
+            do right--; while (BEFORE(pivot, array[right]));                                        \
+                                                                                                    \
+            if (left >= right)                                                                      \
+                break;                                                                              \
+                                                                                                    \
+            element = array[left];                                                                  \
+            array[left] = array[right];                                                             \
+            array[right] = element;                                                                 \
+        }                                                                                           \
+                                                                                                    \
+        /* Recurse into the smaller partition and loop over the bigger one */                       \
+        if ((size_t)right + 1 < count - right - 1)                                                  \
+        {                                                                                           \
+            __Dynarr_IntroSortLoop##Name(array, right + 1, depth);                                  \
+            array += right + 1;                                                                     \
+            count -= right + 1;                                                                     \
+        }                                                                                           \
+        else                                                                                        \
+        {                                                                                           \
+            __Dynarr_IntroSortLoop##Name(array + right + 1, count - right - 1, depth);              \
+            count = right + 1;                                                                      \
+        }                                                                                           \
+    }                                                                                               \
+                                                                                                    \
+    __Dynarr_InsertionSort##Name(array, count);                                                     \
+}                                                                                                   \
+                                                                                                    \
+static void __Dynarr_IntroSort##Name (T* array, size_t count)                                       \
+{                                                                                                   \
+    size_t depth = 0;                                                                               \
+                                                                                                    \
+    for (size_t counter = count; counter > 1; counter >>= 1)                                        \
+        depth += 2;                                                                                 \
+                                                                                                    \
+    __Dynarr_IntroSortLoop##Name(array, count, depth);                                              \
+}
+
+__DYNARR_DEFINE_INTROSORT(Char, signed char, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(Short, short, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(Int, int, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(Long, long, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(LLong, long long, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(UChar, unsigned char, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(UShort, unsigned short, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(UInt, unsigned int, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(ULong, unsigned long, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(ULLong, unsigned long long, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(Float, float, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(Double, double, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(LDouble, long double, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(Ptr, uintptr_t, __DYNARR_ASCENDING)
+__DYNARR_DEFINE_INTROSORT(CharDesc, signed char, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(ShortDesc, short, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(IntDesc, int, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(LongDesc, long, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(LLongDesc, long long, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(UCharDesc, unsigned char, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(UShortDesc, unsigned short, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(UIntDesc, unsigned int, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(ULongDesc, unsigned long, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(ULLongDesc, unsigned long long, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(FloatDesc, float, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(DoubleDesc, double, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(LDoubleDesc, long double, __DYNARR_DESCENDING)
+__DYNARR_DEFINE_INTROSORT(PtrDesc, uintptr_t, __DYNARR_DESCENDING)
+
+/* Key transforms that make the bits of each type sort correctly as unsigned integers. */
+#define __DYNARR_KEY_UNSIGNED(U, bits) (bits)
+#define __DYNARR_KEY_SIGNED(U, bits) ((U)((bits) ^ ((U)1 << (sizeof(U) * 8 - 1))))
+#define __DYNARR_KEY_FLOAT(U, bits) ((U)(((bits) >> (sizeof(U) * 8 - 1)) ? ~(bits) : (bits) | ((U)1 << (sizeof(U) * 8 - 1))))
+
+/** \brief Defines a stable LSD radix sort kernel with 8-bit digits.
+ * \details The histograms of all digits are built in a single pass, and passes in which every element
+ * shares the same digit are skipped. Descending order is achieved by inverting the keys.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ * \param Name The suffix of the generated function.
+ * \param U The unsigned integer type that holds the bits of each element.
+ * \param KEY A macro that turns the bits of an element into an unsigned key.
+ */
+#define __DYNARR_DEFINE_RADIXSORT(Name, U, KEY)                                                     \
+static int __Dynarr_RadixSort##Name (U* array, size_t count, int descending)                        \
+{                                                                                                   \
+    size_t histogram[sizeof(U)][256] = {{0}};                                                       \
+    size_t counter, pass, offset, amount;                                                           \
+    U flip = descending ? (U)~(U)0 : 0, key;                                                        \
+    U* buffer = malloc(count * sizeof(U));                                                          \
+    U* from = array;                                                                                \
+    U* to = buffer;                                                                                 \
+    U* swap;                                                                                        \
+                                                                                                    \
+    if (!buffer)                                                                                    \
+        return 0;                                                                                   \
+                                                                                                    \
+    for (counter = 0; counter < count; counter++)                                                   \
+    {                                                                                               \
+        key = KEY(U, array[counter]) ^ flip;                                                        \
+        for (pass = 0; pass < sizeof(U); pass++)                                                    \
+            histogram[pass][(key >> (pass * 8)) & 0xFF]++;                                          \
+    }                                                                                               \
+                                                                                                    \
+    for (pass = 0; pass < sizeof(U); pass++)                                                        \
+    {                                                                                               \
+        size_t* digits = histogram[pass];                                                           \
+                                                                                                    \
+        /* Skip the pass if every element has the same digit */                                     \
+        key = KEY(U, from[0]) ^ flip;                                                               \
+        if (digits[(key >> (pass * 8)) & 0xFF] == count)                                            \
+            continue;                                                                               \
+                                                                                                    \
+        /* Turn the histogram into the starting offset of each digit */                             \
+        for (counter = 0, offset = 0; counter < 256; counter++)                                     \
+        {                                                                                           \
+            amount = digits[counter];                                                               \
+            digits[counter] = offset;                                                               \
+            offset += amount;                                                                       \
+        }                                                                                           \
+                                                                                                    \
+        for (counter = 0; counter < count; counter++)                                               \
+        {                                                                                           \
+            key = KEY(U, from[counter]) ^ flip;                                                     \
+            to[digits[(key >> (pass * 8)) & 0xFF]++] = from[counter];                               \
+        }                                                                                           \
+                                                                                                    \
+        swap = from;                                                                                \
+        from = to;                                                                                  \
+        to = swap;                                                                                  \
+    }                                                                                               \
+                                                                                                    \
+    if (from != array)                                                                              \
+        memcpy(array, from, count * sizeof(U));                                                     \
+                                                                                                    \
+    free(buffer);                                                                                   \
+    return 1;                                                                                       \
+}
+
+__DYNARR_DEFINE_RADIXSORT(Unsigned8, __dynarr_u8, __DYNARR_KEY_UNSIGNED)
+__DYNARR_DEFINE_RADIXSORT(Unsigned16, __dynarr_u16, __DYNARR_KEY_UNSIGNED)
+__DYNARR_DEFINE_RADIXSORT(Unsigned32, __dynarr_u32, __DYNARR_KEY_UNSIGNED)
+__DYNARR_DEFINE_RADIXSORT(Unsigned64, __dynarr_u64, __DYNARR_KEY_UNSIGNED)
+__DYNARR_DEFINE_RADIXSORT(Signed8, __dynarr_u8, __DYNARR_KEY_SIGNED)
+__DYNARR_DEFINE_RADIXSORT(Signed16, __dynarr_u16, __DYNARR_KEY_SIGNED)
+__DYNARR_DEFINE_RADIXSORT(Signed32, __dynarr_u32, __DYNARR_KEY_SIGNED)
+__DYNARR_DEFINE_RADIXSORT(Signed64, __dynarr_u64, __DYNARR_KEY_SIGNED)
+__DYNARR_DEFINE_RADIXSORT(Float32, __dynarr_u32, __DYNARR_KEY_FLOAT)
+__DYNARR_DEFINE_RADIXSORT(Float64, __dynarr_u64, __DYNARR_KEY_FLOAT)
+
+/** \brief Radix sorts an array of integers or IEEE-754 floating-point numbers.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] array Pointer to the first element.
+ * \param[in] count Amount of elements in the array.
+ * \param[in] width Size of each element, in bytes.
+ * \param[in] kind 'u' for unsigned integers, 's' for signed integers and 'f' for floating-point numbers.
+ * \param[in] descending Non-zero to sort in descending order.
+ * \retval int
+ * \arg Returns non-zero if the array got sorted.
+ * \arg Returns zero if the type is not supported or memory allocation failed.
+ */
+static int __Dynarr_RadixSort (void* array, size_t count, size_t width, char kind, int descending)
+{
+    switch (width * 256 + kind)
+    {
+        case 1 * 256 + 'u': return __Dynarr_RadixSortUnsigned8(array, count, descending);
+        case 2 * 256 + 'u': return __Dynarr_RadixSortUnsigned16(array, count, descending);
+        case 4 * 256 + 'u': return __Dynarr_RadixSortUnsigned32(array, count, descending);
+        case 8 * 256 + 'u': return __Dynarr_RadixSortUnsigned64(array, count, descending);
+        case 1 * 256 + 's': return __Dynarr_RadixSortSigned8(array, count, descending);
+        case 2 * 256 + 's': return __Dynarr_RadixSortSigned16(array, count, descending);
+        case 4 * 256 + 's': return __Dynarr_RadixSortSigned32(array, count, descending);
+        case 8 * 256 + 's': return __Dynarr_RadixSortSigned64(array, count, descending);
+        case 4 * 256 + 'f': return __Dynarr_RadixSortFloat32(array, count, descending);
+        case 8 * 256 + 'f': return __Dynarr_RadixSortFloat64(array, count, descending);
+        default:            return 0;
+    }
+}
+
+/** \brief Sorts a DynamicArray according to the type of its elements.
+ * \details Integer and floating-point arrays with enough elements are radix sorted. Smaller arrays
+ * and long doubles are sorted by typed introsort kernels, and dynamic variables are sorted with
+ * \c qsort(). No global state is involved, so different arrays can be sorted concurrently.
+ * \remark NaNs are not ordered consistently with other floating-point numbers.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] descending Non-zero to sort in descending order.
+ * \return \c void
+ */
+static void __Dynarr_SortArray (struct DynamicArray* sarray, int descending)
+{
+    void* array = sarray->Array;
+    size_t count = sarray->Count;
+    char kind = 0;
+
+    __Dynarr_MarkSorted(sarray, descending);
+
+    if (count < 2)
+        return;
+
+    switch (sarray->Type)
+    {
+        case Char: case Short: case Int: case Long: case LLong:
+            kind = 's';
+            break;
+
+        case UChar: case UShort: case UInt: case ULong: case ULLong: case Ptr:
+            kind = 'u';
+            break;
+
+        case Float: case Double:
+            kind = 'f';
+            break;
+    }
+
+    if (kind && count >= __DYNARR_RADIX_THRESHOLD && __Dynarr_RadixSort(array, count, sarray->TypeSize, kind, descending))
+        return;
+
+    switch (sarray->Type)
+    {
+        case Char:      descending ? __Dynarr_IntroSortCharDesc(array, count) : __Dynarr_IntroSortChar(array, count); break;
+        case Short:     descending ? __Dynarr_IntroSortShortDesc(array, count) : __Dynarr_IntroSortShort(array, count); break;
+        case Int:       descending ? __Dynarr_IntroSortIntDesc(array, count) : __Dynarr_IntroSortInt(array, count); break;
+        case Long:      descending ? __Dynarr_IntroSortLongDesc(array, count) : __Dynarr_IntroSortLong(array, count); break;
+        case LLong:     descending ? __Dynarr_IntroSortLLongDesc(array, count) : __Dynarr_IntroSortLLong(array, count); break;
+        case UChar:     descending ? __Dynarr_IntroSortUCharDesc(array, count) : __Dynarr_IntroSortUChar(array, count); break;
+        case UShort:    descending ? __Dynarr_IntroSortUShortDesc(array, count) : __Dynarr_IntroSortUShort(array, count); break;
+        case UInt:      descending ? __Dynarr_IntroSortUIntDesc(array, count) : __Dynarr_IntroSortUInt(array, count); break;
+        case ULong:     descending ? __Dynarr_IntroSortULongDesc(array, count) : __Dynarr_IntroSortULong(array, count); break;
+        case ULLong:    descending ? __Dynarr_IntroSortULLongDesc(array, count) : __Dynarr_IntroSortULLong(array, count); break;
+        case Float:     descending ? __Dynarr_IntroSortFloatDesc(array, count) : __Dynarr_IntroSortFloat(array, count); break;
+        case Double:    descending ? __Dynarr_IntroSortDoubleDesc(array, count) : __Dynarr_IntroSortDouble(array, count); break;
+        case LDouble:   descending ? __Dynarr_IntroSortLDoubleDesc(array, count) : __Dynarr_IntroSortLDouble(array, count); break;
+        case Ptr:       descending ? __Dynarr_IntroSortPtrDesc(array, count) : __Dynarr_IntroSortPtr(array, count); break;
+        case Var:       qsort(array, count, sarray->TypeSize, descending ? __Dynarr_CompareVarDesc : __Dynarr_CompareVar); break;
+
+        case Custom:
+            if (!sarray->Custom->Compare)
+                break;
+
+            // The comparison function can't be inverted without global state, so reverse the result instead
+            qsort(array, count, sarray->TypeSize, sarray->Custom->Compare);
+
+            if (descending)
+                __Dynarr_Reverse(array, count, sarray->TypeSize);
+
+            break;
+
+        default:
+            // If data type is not supported, don't do anything
+            break;
+    }
+}
+
+/** \brief Holds the state shared by the threads of a parallel sort.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynarrParallelSort
+{
+    struct DynamicArray* sarray;                    /**< The array being sorted. */
+    void* source;                                   /**< Buffer that holds the sorted runs of the current round. */
+    void* target;                                   /**< Buffer that receives the merged runs of the current round. */
+    size_t* bounds;                                 /**< Index where each run starts, followed by the amount of elements. */
+    size_t runs;                                    /**< Amount of sorted runs in <i>source</i>. */
+    size_t threads;                                 /**< Amount of chunks the array is split into. */
+    int descending;                                 /**< Non-zero if the array is sorted in descending order. */
+    int (*compar)(const void*, const void*);        /**< Custom comparison function, if any. */
+};
+
+/** \brief Compares two elements of an array that is being sorted in parallel.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval int
+ * \arg Returns a negative number if <i>first</i> goes before <i>second</i>, zero if they are equivalent
+ * and a positive number otherwise.
+ */
+static int __Dynarr_CompareForSort (struct __DynarrParallelSort* job, const void* first, const void* second)
+{
+    if (job->compar)
+        return job->compar(first, second);
+    else if (job->sarray->Type == Custom)
+        return job->descending ? job->sarray->Custom->Compare(second, first) : job->sarray->Custom->Compare(first, second);
+    else if (job->sarray->Type == Var)
+        return job->descending ? __Dynarr_CompareVar(second, first) : __Dynarr_CompareVar(first, second);
+
+    return job->descending
+        ? __Dynarr_CompareByType(second, first, job->sarray->Type, job->sarray->TypeSize)
+        : __Dynarr_CompareByType(first, second, job->sarray->Type, job->sarray->TypeSize);
+}
+
+/** \brief Sorts a range of chunks of a parallel sort with the serial sort.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] traversal Pointer to the traversal that runs the sort.
+ * \param[in] first The index of the first chunk.
+ * \param[in] last The index past the last chunk.
+ * \return \c void
+ */
+static void __Dynarr_SortRange (struct __DynarrParallelJob* traversal, size_t first, size_t last)
+{
+    struct __DynarrParallelSort* job = traversal->sort;
+    struct DynamicArray chunk = *job->sarray;
+
+    for (; first < last; first++)
+    {
+        chunk.Array = job->sarray->Array + (job->bounds[first] * chunk.TypeSize);
+        chunk.Count = job->bounds[first + 1] - job->bounds[first];
+
+        if (job->compar)
+            qsort(chunk.Array, chunk.Count, chunk.TypeSize, job->compar);
+        else
+            __Dynarr_SortArray(&chunk, job->descending);
+    }
+}
+
+/** \brief Finds how many elements of the left run are among the first <i>diagonal</i> elements
+ * of the merge of two runs (the merge path).
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval size_t
+ * \arg Returns the amount of elements taken from the left run. Ties are taken from the left run.
+ */
+static size_t __Dynarr_MergePath (struct __DynarrParallelSort* job, const void* left, size_t leftCount, const void* right, size_t rightCount, size_t diagonal)
+{
+    size_t size = job->sarray->TypeSize;
+    size_t low = (diagonal > rightCount) ? diagonal - rightCount : 0;
+    size_t high = (diagonal < leftCount) ? diagonal : leftCount;
+    size_t middle;
+
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+
+        if (__Dynarr_CompareForSort(job, left + (middle * size), right + ((diagonal - middle - 1) * size)) <= 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+/** \brief Merges one slice of the current round of a parallel sort.
+ * \details Each slice is an equal share of the output. It may overlap several pairs of runs, so the
+ * merge path is used to find where the slice starts and ends in each pair.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] job Pointer to the state of the sort.
+ * \param[in] index The index of the slice, from zero to the amount of chunks.
+ * \return \c void
+ */
+static void __Dynarr_MergeSlice (struct __DynarrParallelSort* job, size_t index)
+{
+    size_t size = job->sarray->TypeSize, total = job->bounds[job->runs];
+    size_t sliceStart = total / job->threads * index + ((index < total % job->threads) ? index : total % job->threads);
+    size_t sliceEnd = sliceStart + total / job->threads + (index < total % job->threads);
+
+    for (size_t pair = 0; pair < job->runs; pair += 2)
+    {
+        size_t start = job->bounds[pair];
+        size_t middle = job->bounds[(pair + 1 < job->runs) ? pair + 1 : job->runs];
+        size_t end = job->bounds[(pair + 2 < job->runs) ? pair + 2 : job->runs];
+
+        // Skip pairs that don't overlap with this thread's slice
+        if (end <= sliceStart || start >= sliceEnd)
+            continue;
+
+        const void* left = job->source + (start * size);
+        const void* right = job->source + (middle * size);
+        size_t leftCount = middle - start, rightCount = end - middle;
+        size_t first = ((sliceStart > start) ? sliceStart : start) - start;
+        size_t last = ((sliceEnd < end) ? sliceEnd : end) - start;
+        size_t leftIndex = __Dynarr_MergePath(job, left, leftCount, right, rightCount, first);
+        size_t rightIndex = first - leftIndex;
+        void* output = job->target + ((start + first) * size);
+
+        for (; first < last; first++, output += size)
+        {
+            if (rightIndex >= rightCount || (leftIndex < leftCount && __Dynarr_CompareForSort(job, left + (leftIndex * size), right + (rightIndex * size)) <= 0))
+                memcpy(output, left + (leftIndex++ * size), size);
+            else
+                memcpy(output, right + (rightIndex++ * size), size);
+        }
+    }
+}
+
+/** \brief Merges a range of slices of the current round of a parallel sort.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] traversal Pointer to the traversal that runs the sort.
+ * \param[in] first The index of the first slice.
+ * \param[in] last The index past the last slice.
+ * \return \c void
+ */
+static void __Dynarr_MergeRange (struct __DynarrParallelJob* traversal, size_t first, size_t last)
+{
+    for (; first < last; first++)
+        __Dynarr_MergeSlice(traversal->sort, first);
+}
+
+/** \brief Sorts a DynamicArray with multiple threads.
+ * \details The array is split into chunks that are sorted concurrently. The sorted runs are then merged
+ * in pairs, with each round split into as many equal slices of the output as there are chunks. The chunks
+ * and the slices are processed by the threads of the pool, which are reused by every round.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] threads The amount of chunks the array is split into.
+ * \param[in] descending Non-zero to sort in descending order. Ignored if <i>compar</i> is not NULL.
+ * \param[in] compar Pointer to a custom comparison function, or NULL to sort by type.
+ * \return \c void
+ */
+static void __Dynarr_SortParallel (struct DynamicArray* sarray, size_t threads, int descending, int (*compar)(const void*, const void*))
+{
+    struct __DynarrParallelSort job = { .sarray = sarray, .threads = threads, .descending = descending, .compar = compar };
+    struct __DynarrParallelJob traversal = { .sarray = sarray, .sort = &job };
+    void* buffer = NULL;
+    size_t counter;
+
+    // Custom arrays without a comparison function are left as they are, same as by the serial sort
+    if (!compar && sarray->Type == Custom && !sarray->Custom->Compare)
+    {
+        __Dynarr_SortArray(sarray, descending);
+        return;
+    }
+
+    if (threads > sarray->Count)
+        threads = job.threads = sarray->Count;
+
+    if (threads > 1 && sarray->Count >= DYNARR_PARALLEL_THRESHOLD)
+    {
+        job.bounds = malloc((threads + 1) * sizeof(size_t));
+        buffer = __Dynarr_Allocate(sarray->Alignment, sarray->Count * sarray->TypeSize);
+    }
+
+    // Fall back to the serial sort
+    if (!job.bounds || !buffer)
+    {
+        free(job.bounds);
+        __Dynarr_FreeBuffer(sarray->Alignment, buffer);
+
+        if (compar)
+            DynarrSortCustom(sarray, compar);
+        else
+            __Dynarr_SortArray(sarray, descending);
+
+        return;
+    }
+
+    // Split the array into chunks, each of them a grain of the traversal
+    for (counter = 0; counter < threads; counter++)
+        job.bounds[counter] = sarray->Count / threads * counter;
+
+    job.bounds[threads] = sarray->Count;
+    job.runs = threads;
+
+    __Dynarr_SplitGrains(&traversal, threads, 1);
+    traversal.body = __Dynarr_SortRange;
+    __Dynarr_RunParallel(&traversal);
+
+    // Merge the runs in pairs until only one is left
+    job.source = sarray->Array;
+    job.target = buffer;
+    traversal.body = __Dynarr_MergeRange;
+
+    while (job.runs > 1)
+    {
+        void* swap;
+        __Dynarr_RunParallel(&traversal);
+
+        // Every pair of runs is now a single run
+        for (counter = 0; counter * 2 < job.runs; counter++)
+            job.bounds[counter] = job.bounds[counter * 2];
+
+        job.bounds[counter] = sarray->Count;
+        job.runs = counter;
+
+        swap = job.source;
+        job.source = job.target;
+        job.target = swap;
+    }
+
+    if (job.source != sarray->Array)
+        memcpy(sarray->Array, job.source, sarray->Count * sarray->TypeSize);
+
+    if (compar)
+        sarray->Sorted = DynUnsorted;
+    else
+        __Dynarr_MarkSorted(sarray, descending);
+
+    free(job.bounds);
+    __Dynarr_FreeBuffer(sarray->Alignment, buffer);
+}
+
+/** \brief Returns the amount of processors available to the program.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval size_t
+ * \arg Returns the amount of online processors, or 4 if it can't be determined.
+ */
+static size_t __Dynarr_ProcessorCount (void)
+{
+    #ifdef _SC_NPROCESSORS_ONLN
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+        if (processors > 0)
+            return processors;
+    #endif // _SC_NPROCESSORS_ONLN
+
+    return 4;
+}
+
+/** \brief Waits for parallel traversals and works on them, until the pool is stopped.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] index The index of the thread in the traversals, from 1 to the amount of threads in the pool.
+ * \retval void*
+ * \arg Always returns NULL.
+ */
+static void* __Dynarr_PoolWorker (void* index)
+{
+    struct __DynarrPool* pool = &__Dynarr_Pool;
+    struct __DynarrParallelJob* job;
+    unsigned long seen = 0;     // The generation is reset when the pool starts
+
+    __Dynarr_InPool = 1;
+    pthread_mutex_lock(&pool->lock);
+
+    while (1)
+    {
+        while (!pool->stop && pool->generation == seen)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+
+        if (pool->stop)
+            break;
+
+        seen = pool->generation;
+        job = pool->job;
+        pthread_mutex_unlock(&pool->lock);
+
+        __Dynarr_RunGrains(job, (uintptr_t)index);
+
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->busy == 0)
+            pthread_cond_signal(&pool->done);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/** \brief Starts the threads of the pool. The pool must not be running.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] threads The amount of threads, including the calling thread. Zero for one per processor.
+ * \retval int
+ * \arg If at least one thread was started, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_PoolCreate (size_t threads)
+{
+    struct __DynarrPool* pool = &__Dynarr_Pool;
+    size_t started;
+
+    if (threads == 0)
+        threads = __Dynarr_ProcessorCount();
+
+    if (threads < 2 || !(pool->handles = malloc((threads - 1) * sizeof(pthread_t))))
+        return 0;
+
+    pool->stop = 0;
+    pool->generation = 0;
+
+    for (started = 0; started < threads - 1; started++)
+    {
+        if (pthread_create(&pool->handles[started], NULL, __Dynarr_PoolWorker, (void*)(uintptr_t)(started + 1)))
+            break;
+    }
+
+    pool->threads = started;
+
+    if (started == 0)
+    {
+        free(pool->handles);
+        pool->handles = NULL;
+    }
+
+    return started > 0;
+}
+
+/** \brief Stops the threads of the pool and waits for them to exit, if it's running.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \return \c void
+ */
+static void __Dynarr_PoolDestroy (void)
+{
+    struct __DynarrPool* pool = &__Dynarr_Pool;
+
+    if (!pool->handles)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t counter = 0; counter < pool->threads; counter++)
+        pthread_join(pool->handles[counter], NULL);
+
+    free(pool->handles);
+    pool->handles = NULL;
+    pool->threads = 0;
+}
+
+/** \brief Splits an array into grains of the specified size.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] job Pointer to the traversal.
+ * \param[in] count The amount of elements to be traversed.
+ * \param[in] grain The amount of elements in each grain. Zero for <b>DYNARR_PARALLEL_GRAIN</b>.
+ * \return \c void
+ */
+static void __Dynarr_SplitGrains (struct __DynarrParallelJob* job, size_t count, size_t grain)
+{
+    if (grain == 0)
+        grain = DYNARR_PARALLEL_GRAIN;
+
+    // The index of a grain must fit in half of the bounds of a range
+    if (count / grain >= UINT32_MAX)
+        grain = count / (UINT32_MAX - 1) + 1;
+
+    job->count = count;
+    job->grain = grain;
+    job->grains = (count + grain - 1) / grain;
+}
+
+/** \brief Takes the next grain from the front of a range.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval int
+ * \arg If the range wasn't empty, returns non-zero and stores the index of the grain in <i>grain</i>.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_TakeGrain (struct __DynarrGrainRange* range, size_t* grain)
+{
+    uint64_t bounds = __atomic_load_n(&range->Bounds, __ATOMIC_ACQUIRE);
+
+    do
+    {
+        if ((bounds >> 32) >= (bounds & UINT32_MAX))
+            return 0;
+    } while (!__atomic_compare_exchange_n(&range->Bounds, &bounds, bounds + ((uint64_t)1 << 32), 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    *grain = bounds >> 32;
+
+    return 1;
+}
+
+/** \brief Moves the back half of the range of another thread to the empty range of the calling thread.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval int
+ * \arg If there was anything to steal, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_StealGrains (struct __DynarrGrainRange* victim, struct __DynarrGrainRange* own)
+{
+    uint64_t bounds = __atomic_load_n(&victim->Bounds, __ATOMIC_ACQUIRE);
+    uint64_t next, end, middle;
+
+    do
+    {
+        next = bounds >> 32;
+        end = bounds & UINT32_MAX;
+
+        if (next >= end)
+            return 0;
+
+        middle = next + (end - next) / 2;
+    } while (!__atomic_compare_exchange_n(&victim->Bounds, &bounds, (next << 32) | middle, 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    // Nobody else writes to an empty range, so it can be simply replaced
+    __atomic_store_n(&own->Bounds, (middle << 32) | end, __ATOMIC_RELEASE);
+
+    return 1;
+}
+
+/** \brief Processes grains of a parallel traversal until none are left.
+ * \details The thread works through its own range first, then steals half of the range of the
+ * first thread that still has grains left.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] job Pointer to the traversal.
+ * \param[in] self The index of the calling thread in the traversal.
+ * \return \c void
+ */
+static void __Dynarr_RunGrains (struct __DynarrParallelJob* job, size_t self)
+{
+    size_t grain, counter;
+
+    do
+    {
+        while (__Dynarr_TakeGrain(&job->ranges[self], &grain))
+        {
+            size_t first = grain * job->grain;
+            size_t last = (job->count - first < job->grain) ? job->count : first + job->grain;
+
+            job->body(job, first, last);
+        }
+
+        for (counter = 1; counter < job->participants; counter++)
+        {
+            if (__Dynarr_StealGrains(&job->ranges[(self + counter) % job->participants], &job->ranges[self]))
+                break;
+        }
+    } while (counter < job->participants);
+}
+
+/** \brief Runs a parallel traversal on the pool and waits for it to finish.
+ * \details The pool is started with one thread per processor if it's not running. The traversal runs
+ * on the calling thread alone if it has a single grain, if the pool can't be started or if it's
+ * requested from inside of another traversal.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] job Pointer to the traversal. Its grains must have been set by __Dynarr_SplitGrains().
+ * \return \c void
+ */
+static void __Dynarr_RunParallel (struct __DynarrParallelJob* job)
+{
+    struct __DynarrPool* pool = &__Dynarr_Pool;
+    struct __DynarrGrainRange single = { .Bounds = job->grains };
+    size_t counter;
+    int pooled = 0;
+
+    job->participants = 1;
+    job->ranges = &single;
+
+    if (job->grains > 1 && !__Dynarr_InPool)
+    {
+        pthread_mutex_lock(&pool->submit);
+
+        if ((pool->handles || __Dynarr_PoolCreate(0))
+            && (job->ranges = __Dynarr_Allocate(DYNARR_CACHE_LINE_SIZE, (pool->threads + 1) * sizeof(struct __DynarrGrainRange))))
+        {
+            pooled = 1;
+        }
+        else
+        {
+            job->ranges = &single;
+            pthread_mutex_unlock(&pool->submit);
+        }
+    }
+
+    if (!pooled)
+    {
+        __Dynarr_InPool++;
+        __Dynarr_RunGrains(job, 0);
+        __Dynarr_InPool--;
+
+        return;
+    }
+
+    // Give every thread an equal share of the grains. Threads left without any steal from the others
+    job->participants = pool->threads + 1;
+
+    for (counter = 0; counter < job->participants; counter++)
+        job->ranges[counter].Bounds = ((uint64_t)(job->grains * counter / job->participants) << 32) | (job->grains * (counter + 1) / job->participants);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->busy = pool->threads;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    __Dynarr_InPool = 1;
+    __Dynarr_RunGrains(job, 0);
+    __Dynarr_InPool = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->busy > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+
+    pthread_mutex_unlock(&pool->lock);
+    pthread_mutex_unlock(&pool->submit);
+
+    __Dynarr_FreeBuffer(DYNARR_CACHE_LINE_SIZE, job->ranges);
+}
+
+/** \brief Applies the function of DynarrParallelForEach() to a range of elements.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ */
+static void __Dynarr_ForEachRange (struct __DynarrParallelJob* job, size_t first, size_t last)
+{
+    for (; first < last; first++)
+        job->action(job->sarray->Array + (first * job->sarray->TypeSize), job->context);
+}
+
+/** \brief Applies the function of DynarrParallelMap() to a range of elements.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ */
+static void __Dynarr_MapRange (struct __DynarrParallelJob* job, size_t first, size_t last)
+{
+    for (; first < last; first++)
+        job->transform(job->target->Array + (first * job->target->TypeSize), job->sarray->Array + (first * job->sarray->TypeSize), job->context);
+}
+
+/** \brief Evaluates the predicate of DynarrParallelFilter() on a range of elements and counts the accepted ones.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ */
+static void __Dynarr_SelectRange (struct __DynarrParallelJob* job, size_t first, size_t last)
+{
+    size_t accepted = 0;
+
+    for (size_t counter = first; counter < last; counter++)
+        accepted += job->selected[counter] = (job->predicate(job->sarray->Array + (counter * job->sarray->TypeSize)) != 0);
+
+    job->offsets[first / job->grain] = accepted;
+}
+
+/** \brief Copies the accepted elements of a range to the result of DynarrParallelFilter().
+ * \details Consecutive accepted elements are copied as a single block.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ */
+static void __Dynarr_GatherRange (struct __DynarrParallelJob* job, size_t first, size_t last)
+{
+    size_t size = job->sarray->TypeSize;
+    size_t output = job->offsets[first / job->grain];
+    size_t start;
+
+    while (first < last)
+    {
+        for (; first < last && !job->selected[first]; first++);
+        for (start = first; first < last && job->selected[first]; first++);
+
+        __Dynarr_CopyElements(job->target, job->target->Array + (output * size), job->sarray->Array + (start * size), first - start);
+        output += first - start;
+    }
+}
+
+/** \brief Returns a pointer to the slot of the specified element of a DynarrConcurrent.
+ * \details Segment <i>k</i> holds 2^(k + <b>__DYNARR_SEGMENT_SHIFT</b>) elements, so the segment of an element is
+ * given by the position of the highest set bit of its index, offset by the size of the first segment. Segments are
+ * allocated by the first thread that needs them. If several threads race to do it, only one buffer is kept. If
+ * the segment can't be allocated, it's marked as dead so its slots count as empty.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] carray Pointer to a DynarrConcurrent.
+ * \param[in] index Index of the element.
+ * \param[out] ready If not NULL, receives a pointer to the flag that tells whether the element is completely written.
+ * \retval void*
+ * \arg If successful, returns a pointer to the slot.
+ * \arg If the segment of the slot is dead, returns NULL.
+ */
+static void* __Dynarr_ConcurrentSlot (struct DynarrConcurrent* carray, size_t index, unsigned char** ready)
+{
+    unsigned long long position = (unsigned long long)index + ((size_t)1 << __DYNARR_SEGMENT_SHIFT);
+    size_t segment = (sizeof(position) * 8 - 1 - __builtin_clzll(position)) - __DYNARR_SEGMENT_SHIFT;
+    size_t length = (size_t)1 << (segment + __DYNARR_SEGMENT_SHIFT);
+    void* buffer = __atomic_load_n(&carray->Segments[segment], __ATOMIC_ACQUIRE);
+    void* fresh;
+
+    if (!buffer)
+    {
+        // The elements are followed by their flags
+        if (length > SIZE_MAX / (carray->TypeSize + 1) || !(fresh = calloc(length, carray->TypeSize + 1)))
+            fresh = &__Dynarr_DeadSegment;
+
+        if (__atomic_compare_exchange_n(&carray->Segments[segment], &buffer, fresh, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            buffer = fresh;
+        else if (fresh != &__Dynarr_DeadSegment)
+            free(fresh);
+    }
+
+    if (buffer == &__Dynarr_DeadSegment)
+        return NULL;
+
+    if (ready)
+        *ready = buffer + (length * carray->TypeSize) + (position - length);
+
+    return buffer + ((position - length) * carray->TypeSize);
+}
+
+/** \brief Allocates the segments of a DynarrConcurrent that hold the specified range of elements.
+ * \details Segments that are already allocated are left as they are, so many threads can call this for
+ * overlapping ranges.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] carray Pointer to a DynarrConcurrent.
+ * \param[in] first Index of the first element.
+ * \param[in] amount The amount of elements. It must be greater than zero.
+ * \retval int
+ * \arg If every segment of the range is allocated, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_ConcurrentAllocate (struct DynarrConcurrent* carray, size_t first, size_t amount)
+{
+    size_t offset = (size_t)1 << __DYNARR_SEGMENT_SHIFT;
+    unsigned long long position;
+    int allocated = 1;
+
+    while (1)
+    {
+        // Keep going after a failure, so every segment of the range is either allocated or dead
+        if (!__Dynarr_ConcurrentSlot(carray, first, NULL))
+            allocated = 0;
+
+        // Skip to the first element of the next segment, which starts at the next power of two
+        position = (unsigned long long)first + offset;
+        position = 2ULL << (sizeof(position) * 8 - 1 - __builtin_clzll(position));
+
+        if (position - offset - first >= amount)
+            return allocated;
+
+        amount -= position - offset - first;
+        first = position - offset;
+    }
+}
+
+/** \brief Checks whether the slot of the specified element of a DynarrConcurrent has been resolved.
+ * \details A slot is resolved once its element is completely written or it's left empty. Unlike
+ * __Dynarr_ConcurrentSlot(), this never allocates a segment.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] carray Pointer to a DynarrConcurrent.
+ * \param[in] index Index of the element.
+ * \retval int
+ * \arg If the slot is resolved, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_ConcurrentResolved (struct DynarrConcurrent* carray, size_t index)
+{
+    unsigned long long position = (unsigned long long)index + ((size_t)1 << __DYNARR_SEGMENT_SHIFT);
+    size_t segment = (sizeof(position) * 8 - 1 - __builtin_clzll(position)) - __DYNARR_SEGMENT_SHIFT;
+    size_t length = (size_t)1 << (segment + __DYNARR_SEGMENT_SHIFT);
+    unsigned char* buffer = __atomic_load_n(&carray->Segments[segment], __ATOMIC_ACQUIRE);
+
+    if (!buffer)
+        return 0;
+    else if (buffer == &__Dynarr_DeadSegment)
+        return 1;
+
+    return __atomic_load_n(buffer + (length * carray->TypeSize) + (position - length), __ATOMIC_ACQUIRE) != 0;
+}
+
+/** \brief Publishes the elements of a DynarrConcurrent that are resolved and follow the published ones.
+ * \details Every writer calls this after resolving its slots, so the last writer of a gap always closes it.
+ * The run of resolved slots after the published ones is published with a single atomic operation. Writers
+ * that finish out of order leave the publishing to the writers before them.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] carray Pointer to a DynarrConcurrent.
+ * \return \c void
+ */
+static void __Dynarr_ConcurrentPublish (struct DynarrConcurrent* carray)
+{
+    // A read-modify-write, so either this writer sees the slots resolved by the others or they see its own
+    size_t published = __atomic_fetch_add(&carray->Published, 0, __ATOMIC_ACQ_REL);
+    size_t reserved, end;
+
+    while (1)
+    {
+        reserved = __atomic_load_n(&carray->Reserved, __ATOMIC_ACQUIRE);
+
+        for (end = published; end < reserved && __Dynarr_ConcurrentResolved(carray, end); end++);
+
+        if (end == published)
+            return;
+
+        // If another writer got there first, continue from wherever it left off
+        if (__atomic_compare_exchange_n(&carray->Published, &published, end, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            published = end;
+    }
+}
+
+/** \brief Compares two values of the specified data type.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] first Pointer to the first value.
+ * \param[in] second Pointer to the second value.
+ * \param[in] DType The data type of both values.
+ * \param[in] size The size of the values, in bytes. Only used for custom data.
+ * \retval int
+ * \arg Returns -1 if the first value is less than the second value.
+ * \arg Returns 0 if both values are equal.
+ * \arg Returns 1 if the first value is greater than the second value.
+ */
+static int __Dynarr_CompareByType (const void* first, const void* second, enum DataType DType, size_t size)
+{
+    #define __DYNARR_THREE_WAY(T) return (*(const T*)first > *(const T*)second) - (*(const T*)first < *(const T*)second)
+
+    switch (DType)
+    {
+        case Char:      __DYNARR_THREE_WAY(signed char);
+        case Short:     __DYNARR_THREE_WAY(short);
+        case Int:       __DYNARR_THREE_WAY(int);
+        case Long:      __DYNARR_THREE_WAY(long);
+        case LLong:     __DYNARR_THREE_WAY(long long);
+        case UChar:     __DYNARR_THREE_WAY(unsigned char);
+        case UShort:    __DYNARR_THREE_WAY(unsigned short);
+        case UInt:      __DYNARR_THREE_WAY(unsigned int);
+        case ULong:     __DYNARR_THREE_WAY(unsigned long);
+        case ULLong:    __DYNARR_THREE_WAY(unsigned long long);
+        case Float:     __DYNARR_THREE_WAY(float);
+        case Double:    __DYNARR_THREE_WAY(double);
+        case LDouble:   __DYNARR_THREE_WAY(long double);
+        case Ptr:       __DYNARR_THREE_WAY(uintptr_t);
+        case String:    return strcmp(first, second);
+        default:        return memcmp(first, second, size);
+    }
+
+    #undef __DYNARR_THREE_WAY
+}
+
+/** \brief This function is used as a <i>compar</i> function on \c qsort() for arrays of dynamic variables.
+ * \remark Variables that store data of different types are sorted by type. Otherwise, they are sorted by value.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] first Pointer to the first DynamicVariable.
+ * \param[in] second Pointer to the second DynamicVariable.
+ * \retval int
+ * \arg Returns a negative number if the first variable should be placed before the second one.
+ * \arg Returns zero if both variables are equal.
+ * \arg Returns a positive number if the first variable should be placed after the second one.
+ */
+static int __Dynarr_CompareVar (const void* first, const void* second)
+{
+    const struct DynamicVariable* firstVar = first;
+    const struct DynamicVariable* secondVar = second;
+
+    // If they don't store data of the same type, sort by type
+    if (firstVar->Type != secondVar->Type)
+        return (firstVar->Type > secondVar->Type) - (firstVar->Type < secondVar->Type);
+
+    // Otherwise, sort by value
+    return __Dynarr_CompareByType(firstVar->Data, secondVar->Data, firstVar->Type, (firstVar->Size < secondVar->Size) ? firstVar->Size : secondVar->Size);
+}
+
+/** \brief This function is a wrapper for the __Dynarr_CompareVar() function.
+ * \remark It takes its returned value and inverts it.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] first Pointer to the first DynamicVariable.
+ * \param[in] second Pointer to the second DynamicVariable.
+ * \retval int
+ * \arg Returns the output of __Dynarr_CompareVar() with its sign inverted.
+ */
+static int __Dynarr_CompareVarDesc (const void* first, const void* second)
+{
+    return __Dynarr_CompareVar(second, first);
+}
+
+/** \brief Defines the body of a scalar search over an array of unsigned integers of type <i>T</i>.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_SEARCH_SCALAR(T)                                           \
+    {                                                                       \
+        const T* typed = (const T*)array;                                   \
+        T needle;                                                           \
+        memcpy(&needle, value, sizeof(T));                                  \
+                                                                            \
+        if (mode == __DynarrFindFirst)                                      \
+        {                                                                   \
+            for (counter = 0; counter < count; counter++)                   \
+                if (typed[counter] == needle) return counter;               \
+            return count;                                                   \
+        }                                                                   \
+        else if (mode == __DynarrFindLast)                                  \
+        {                                                                   \
+            for (counter = count; counter-- > 0;)                           \
+                if (typed[counter] == needle) return counter;               \
+            return count;                                                   \
+        }                                                                   \
+                                                                            \
+        for (counter = 0; counter < count; counter++)                       \
+            found += typed[counter] == needle;                              \
+        return found;                                                       \
+    }
+
+/** \brief Searches an array of 1, 2, 4 or 8-byte elements for the ones that are bitwise equal to <i>value</i>.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] array Pointer to the first element.
+ * \param[in] count Amount of elements in the array.
+ * \param[in] width Size of each element, in bytes.
+ * \param[in] value Pointer to the value to be searched for.
+ * \param[in] mode What to search for.
+ * \retval size_t
+ * \arg Returns the index of the first or last match, or <i>count</i> if there's none.
+ * \arg If <i>mode</i> is \c __DynarrFindCount, returns the amount of matches.
+ */
+static size_t __Dynarr_SearchScalar (const unsigned char* array, size_t count, size_t width, const void* value, enum __DynarrSearchMode mode)
+{
+    size_t counter, found = 0;
+
+    switch (width)
+    {
+        case 1:     __DYNARR_SEARCH_SCALAR(__dynarr_u8)
+        case 2:     __DYNARR_SEARCH_SCALAR(__dynarr_u16)
+        case 4:     __DYNARR_SEARCH_SCALAR(__dynarr_u32)
+        default:    __DYNARR_SEARCH_SCALAR(__dynarr_u64)
+    }
+}
+
+#ifdef __DYNARR_X86_64
+
+/** \brief Compares 16 bytes of an array with a broadcast value, element by element.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval unsigned int
+ * \arg Returns a mask with one bit per byte. All bytes of a matching element are set.
+ */
+static inline unsigned int __Dynarr_MatchMaskSSE2 (__m128i chunk, __m128i needle, size_t width)
+{
+    __m128i equal;
+
+    switch (width)
+    {
+        case 1:     equal = _mm_cmpeq_epi8(chunk, needle); break;
+        case 2:     equal = _mm_cmpeq_epi16(chunk, needle); break;
+        case 4:     equal = _mm_cmpeq_epi32(chunk, needle); break;
+        default:    // SSE2 has no 64-bit comparison, so both halves of each element must match
+            equal = _mm_cmpeq_epi32(chunk, needle);
+            equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+            break;
+    }
+
+    return (unsigned int)_mm_movemask_epi8(equal);
+}
+
+/** \brief Compares 32 bytes of an array with a broadcast value, element by element.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval unsigned int
+ * \arg Returns a mask with one bit per byte. All bytes of a matching element are set.
+ */
+__attribute__((target("avx2")))
+static inline unsigned int __Dynarr_MatchMaskAVX2 (__m256i chunk, __m256i needle, size_t width)
+{
+    __m256i equal;
+
+    switch (width)
+    {
+        case 1:     equal = _mm256_cmpeq_epi8(chunk, needle); break;
+        case 2:     equal = _mm256_cmpeq_epi16(chunk, needle); break;
+        case 4:     equal = _mm256_cmpeq_epi32(chunk, needle); break;
+        default:    equal = _mm256_cmpeq_epi64(chunk, needle); break;
+    }
+
+    return (unsigned int)_mm256_movemask_epi8(equal);
+}
+
+/** \brief Defines the body of a vectorized search. Each chunk holds <i>LANES</i> bytes.
+ * \details Since all bytes of a matching element are set in the mask, the index of a match is found by
+ * dividing the position of its bits by the element width, and the amount of matches is given by the
+ * amount of set bits divided by the element width. Leftover elements are handled by the scalar search.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_SEARCH_VECTOR(LANES, LOAD, MATCH)                                                  \
+    size_t bytes = count * width, full = bytes - (bytes % LANES), offset, tail, found = 0;          \
+    unsigned int mask;                                                                              \
+    tail = (bytes - full) / width;                                                                  \
+                                                                                                    \
+    if (mode == __DynarrFindFirst)                                                                  \
+    {                                                                                               \
+        for (offset = 0; offset < full; offset += LANES)                                            \
+        {                                                                                           \
+            if ((mask = MATCH(LOAD(array + offset), needle, width)))                                \
+                return (offset + __builtin_ctz(mask)) / width;                                      \
+        }                                                                                           \
+                                                                                                    \
+        found = __Dynarr_SearchScalar(array + full, tail, width, value, mode);                      \
+        return (found == tail) ? count : full / width + found;                                      \
+    }                                                                                               \
+    else if (mode == __DynarrFindLast)                                                              \
+    {                                                                                               \
+        found = __Dynarr_SearchScalar(array + full, tail, width, value, mode);                      \
+        if (found != tail)                                                                          \
+            return full / width + found;                                                            \
+                                                                                                    \
+        for (offset = full; offset > 0; offset -= LANES)                                            \
+        {                                                                                           \
+            if ((mask = MATCH(LOAD(array + offset - LANES), needle, width)))                        \
+                return (offset - LANES + (31 - __builtin_clz(mask))) / width;                       \
+        }                                                                                           \
+                                                                                                    \
+        return count;                                                                               \
+    }                                                                                               \
+                                                                                                    \
+    for (offset = 0; offset < full; offset += LANES)                                                \
+        found += __builtin_popcount(MATCH(LOAD(array + offset), needle, width));                    \
+                                                                                                    \
+    return found / width + __Dynarr_SearchScalar(array + full, tail, width, value, mode)
+
+#define __DYNARR_LOAD_SSE2(pointer) _mm_loadu_si128((const __m128i*)(pointer))
+#define __DYNARR_LOAD_AVX2(pointer) _mm256_loadu_si256((const __m256i*)(pointer))
+
+/** \brief Searches an array of 1, 2, 4 or 8-byte elements with SSE2 instructions.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval size_t
+ * \arg Same as __Dynarr_SearchScalar().
+ */
+static size_t __Dynarr_SearchSSE2 (const unsigned char* array, size_t count, size_t width, const void* value, enum __DynarrSearchMode mode)
+{
+    __m128i needle;
+    uint64_t raw = 0;
+    memcpy(&raw, value, width);
+
+    switch (width)
+    {
+        case 1:     needle = _mm_set1_epi8((char)raw); break;
+        case 2:     needle = _mm_set1_epi16((short)raw); break;
+        case 4:     needle = _mm_set1_epi32((int)raw); break;
+        default:    needle = _mm_set1_epi64x((long long)raw); break;
+    }
+
+    __DYNARR_SEARCH_VECTOR(16, __DYNARR_LOAD_SSE2, __Dynarr_MatchMaskSSE2);
+}
+
+/** \brief Searches an array of 1, 2, 4 or 8-byte elements with AVX2 instructions.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \retval size_t
+ * \arg Same as __Dynarr_SearchScalar().
+ */
+__attribute__((target("avx2")))
+static size_t __Dynarr_SearchAVX2 (const unsigned char* array, size_t count, size_t width, const void* value, enum __DynarrSearchMode mode)
+{
+    __m256i needle;
+    uint64_t raw = 0;
+    memcpy(&raw, value, width);
+
+    switch (width)
+    {
+        case 1:     needle = _mm256_set1_epi8((char)raw); break;
+        case 2:     needle = _mm256_set1_epi16((short)raw); break;
+        case 4:     needle = _mm256_set1_epi32((int)raw); break;
+        default:    needle = _mm256_set1_epi64x((long long)raw); break;
+    }
+
+    __DYNARR_SEARCH_VECTOR(32, __DYNARR_LOAD_AVX2, __Dynarr_MatchMaskAVX2);
+}
+
+#endif // __DYNARR_X86_64
+
+/** \brief Searches a DynamicArray for the elements that match the specified data.
+ * \details Arrays of 1, 2, 4 or 8-byte elements are compared bitwise with SIMD instructions, if the CPU
+ * supports them (AVX2 is detected at runtime on x86-64). Dynamic variables are compared by their value,
+ * and everything else is compared with \c memcmp().
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] sarray Pointer to a DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \param[in] mode What to search for.
+ * \retval size_t
+ * \arg Returns the index of the first or last match, or the amount of elements in the array if there's none.
+ * \arg If <i>mode</i> is \c __DynarrFindCount, returns the amount of matches.
+ */
+static size_t __Dynarr_Search (struct DynamicArray* sarray, void* element, enum __DynarrSearchMode mode)
+{
+    size_t counter, found = 0;
+    int matched;
+
+    const struct DynarrCustomType* custom = (sarray->Type == Custom) ? sarray->Custom : NULL;
+
+    if (sarray->Type != Var && !(custom && custom->Compare) && (sarray->TypeSize == 1 || sarray->TypeSize == 2 || sarray->TypeSize == 4 || sarray->TypeSize == 8))
+    {
+        #ifdef __DYNARR_X86_64
+            if (__builtin_cpu_supports("avx2"))
+                return __Dynarr_SearchAVX2(sarray->Array, sarray->Count, sarray->TypeSize, element, mode);
+
+            return __Dynarr_SearchSSE2(sarray->Array, sarray->Count, sarray->TypeSize, element, mode);
+        #else
+            return __Dynarr_SearchScalar(sarray->Array, sarray->Count, sarray->TypeSize, element, mode);
+        #endif // __DYNARR_X86_64
+    }
+
+    for (counter = 0; counter < sarray->Count; counter++)
+    {
+        // Search from the end of the array if looking for the last match
+        size_t index = (mode == __DynarrFindLast) ? sarray->Count - counter - 1 : counter;
+
+        matched = __Dynarr_Matches(sarray, sarray->Array + (index * sarray->TypeSize), element);
+
+        if (matched && mode != __DynarrFindCount)
+            return index;
+
+        found += matched;
+    }
+
+    return (mode == __DynarrFindCount) ? found : sarray->Count;
+}
+
+/** \brief Checks if an element of a DynamicArray matches the specified data.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] sarray Pointer to the DynamicArray the element belongs to.
+ * \param[in] stored Pointer to the element.
+ * \param[in] element The data to be matched.
+ * \retval int
+ * \arg Returns non-zero if the element matches the data.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_Matches (struct DynamicArray* sarray, void* stored, void* element)
+{
+    // This is horrid, but memcmp() is stupid.
+    if (sarray->Type == Var)
+        return !__Dynarr_VarCmp(stored, element);
+    else if (sarray->Type == Custom && sarray->Custom->Compare)
+        return !sarray->Custom->Compare(stored, element);
+    else
+        return !memcmp(stored, element, sarray->TypeSize);
+}
+
+/** \brief This function compares the value stored in 2 DynamicVariables with each other.
+ * \remark If the result is greater than zero, it means that the first value is greater than
+ * the second one and vice-versa. If result is equal to zero, both values are equal.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] first Pointer to the first DynamicVariable.
+ * \param[in] second Pointer to the second DynamicVariable.
+ * \retval int
+ * \arg Returns zero if both values match.
+ * \arg Otherwise, returns any non-zero number.
+ */
+static int __Dynarr_VarCmp (struct DynamicVariable* first, struct DynamicVariable* second)
+{
+    // This function could be discarded if I reorganize the Dynarr struct and check
+    // for the type with basic pointer arithmetic on __Dynarr_CompareByType(), but
+    // I can't be bothered
+    switch (second->Type)
+    {
+        // This weird amalgamation is to prevent chars from being matched with
+        // strings and vice-versa
+        case String:
+            if (first->Type == second->Type)
+                return strcmp(first->Data, second->Data);
+
+        case Char:
+        case UChar:
+            if (first->Size != second->Size)
+                return -1;
 
-        case Int:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%d%s", ((int*)sarray->Array)[counter], delimiter);
-            break;
+        default: // The ternary is necessary to prevent unallocated bytes from being read in case one type is bigger than another
+            return memcmp(first->Data, second->Data, (first->Size < second->Size) ? first->Size : second->Size);
+    }
+}
 
-        case Long:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%ld%s", ((long*)sarray->Array)[counter], delimiter);
-            break;
+/** \brief Amount of independent accumulators used by the reduction kernels. */
+#define __DYNARR_LANES 8
 
-        case LLong:
-            for (counter = 0; counter < sarray->Count; counter++)
-                #ifdef _WIN32
-                    __mingw_printf("%lld%s", ((long long*)sarray->Array)[counter], delimiter);
-                #else
-                    printf("%lld%s", ((long long*)sarray->Array)[counter], delimiter);
-                #endif // _WIN32
-            break;
+/** \brief Amount of elements below which the pairwise summation stops splitting the array. */
+#define __DYNARR_PAIRWISE_BLOCK 256
 
-        case Float:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%.6g%s", ((float*)sarray->Array)[counter], delimiter);
-            break;
+/** \brief Compiles the function once for AVX2 and once for the baseline instruction set. The best
+ * version is picked at load time. Only available where the toolchain supports it.
+ */
+#if defined(__DYNARR_X86_64) && defined(__linux__)
+    #define __DYNARR_SIMD __attribute__((target_clones("avx2", "default")))
+#else
+    #define __DYNARR_SIMD
+#endif
+
+/** \brief Marks the loop of a kernel, so it's inlined into each of its copies. */
+#define __DYNARR_KERNEL static inline __attribute__((always_inline))
+
+/** \brief Defines <i>Name</i> as a kernel that runs the loop <i>Loop</i> over elements <i>stride</i>
+ * elements apart from each other. Adjacent elements get a copy of the loop of their own, so it can be vectorized.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_DEFINE_STRIDED(R, Name, Loop, T)                                                   \
+__DYNARR_SIMD static R Name (const T* array, size_t count, size_t stride)                           \
+{                                                                                                   \
+    return (stride == 1) ? Loop(array, count, 1) : Loop(array, count, stride);                      \
+}
 
-        case Double:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%.15g%s", ((double*)sarray->Array)[counter], delimiter);
-            break;
+/** \brief Defines a kernel that finds the index of the first element that is the smallest (or biggest,
+ * depending on <i>BEFORE</i>) in an array. The extreme value is found with independent lanes, so the
+ * loop can be vectorized, and then its first occurrence is searched for.
+ * \remark NaNs are ignored: the lanes are seeded with the first element that isn't NaN, and a NaN never
+ * compares before anything, so it can't replace the value of a lane. If every element is NaN, returns 0.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_DEFINE_ARGBEST(Name, T, BEFORE)                                                    \
+__DYNARR_KERNEL size_t __Dynarr_Arg##Name##Loop (const T* array, size_t count, size_t stride)       \
+{                                                                                                   \
+    T lanes[__DYNARR_LANES], best;                                                                  \
+    size_t counter, lane;                                                                           \
+                                                                                                    \
+    /* Only NaNs don't compare equal to themselves */                                               \
+    for (counter = 0; counter < count && array[counter * stride] != array[counter * stride]; counter++); \
+                                                                                                    \
+    if (counter == count)                                                                           \
+        return 0;                                                                                   \
+                                                                                                    \
+    for (lane = 0; lane < __DYNARR_LANES; lane++)                                                   \
+        lanes[lane] = array[counter * stride];                                                      \
+                                                                                                    \
+    for (counter = 0; counter + __DYNARR_LANES <= count; counter += __DYNARR_LANES)                 \
+        for (lane = 0; lane < __DYNARR_LANES; lane++)                                               \
+            lanes[lane] = BEFORE(array[(counter + lane) * stride], lanes[lane]) ? array[(counter + lane) * stride] : lanes[lane]; \
+                                                                                                    \
+    for (best = lanes[0], lane = 1; lane < __DYNARR_LANES; lane++)                                  \
+        best = BEFORE(lanes[lane], best) ? lanes[lane] : best;                                      \
+                                                                                                    \
+    for (; counter < count; counter++)                                                              \
+        best = BEFORE(array[counter * stride], best) ? array[counter * stride] : best;              \
+                                                                                                    \
+    /* Find the first occurrence of the value, which is never NaN */                                \
+    for (counter = 0; counter < count && !(array[counter * stride] == best); counter++);            \
+    return counter;                                                                                 \
+}                                                                                                   \
+                                                                                                    \
+__DYNARR_DEFINE_STRIDED(size_t, __Dynarr_Arg##Name, __Dynarr_Arg##Name##Loop, T)
+
+/** \brief Defines the sum kernel of an integer type. The lanes are 64-bit wide, so small integers
+ * can't overflow, and they're unsigned, so the sum of signed types wraps around instead of
+ * invoking undefined behavior.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_DEFINE_SUM_INTEGER(Name, T)                                                        \
+__DYNARR_KERNEL unsigned long long __Dynarr_SimpleSum##Name##Loop (const T* array, size_t count, size_t stride) \
+{                                                                                                   \
+    unsigned long long lanes[__DYNARR_LANES] = {0}, sum = 0;                                        \
+    size_t counter, lane;                                                                           \
+                                                                                                    \
+    for (counter = 0; counter + __DYNARR_LANES <= count; counter += __DYNARR_LANES)                 \
+        for (lane = 0; lane < __DYNARR_LANES; lane++)                                               \
+            lanes[lane] += (unsigned long long)array[(counter + lane) * stride];                    \
+                                                                                                    \
+    for (; counter < count; counter++)                                                              \
+        sum += (unsigned long long)array[counter * stride];                                         \
+                                                                                                    \
+    for (lane = 0; lane < __DYNARR_LANES; lane++)                                                   \
+        sum += lanes[lane];                                                                         \
+                                                                                                    \
+    return sum;                                                                                     \
+}                                                                                                   \
+                                                                                                    \
+__DYNARR_DEFINE_STRIDED(unsigned long long, __Dynarr_SimpleSum##Name, __Dynarr_SimpleSum##Name##Loop, T) \
+                                                                                                    \
+static unsigned long long __Dynarr_Sum##Name (const T* array, size_t count, size_t stride, enum DynarrSummation summation) \
+{                                                                                                   \
+    (void)summation;                                                                                \
+    return __Dynarr_SimpleSum##Name(array, count, stride);                                          \
+}
 
-        case LDouble:
-            for (counter = 0; counter < sarray->Count; counter++)
-                #ifdef _WIN32
-                    __mingw_printf("%.19Lg%s", ((long double*)sarray->Array)[counter], delimiter);
-                #else
-                    printf("%.19Lg%s", ((long double*)sarray->Array)[counter], delimiter);
-                #endif // _WIN32
-            break;
+/** \brief Defines the sum kernels of a floating-point type. Elements are accumulated as <i>ACC</i>.
+ * \details The simple sum uses independent lanes. The pairwise sum splits the array in halves until
+ * they're small enough for the simple sum. The Kahan sum keeps a running compensation in each lane.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_DEFINE_SUM_FLOAT(Name, T, ACC)                                                     \
+__DYNARR_KERNEL ACC __Dynarr_SimpleSum##Name##Loop (const T* array, size_t count, size_t stride)    \
+{                                                                                                   \
+    ACC lanes[__DYNARR_LANES] = {0}, sum = 0;                                                       \
+    size_t counter, lane;                                                                           \
+                                                                                                    \
+    for (counter = 0; counter + __DYNARR_LANES <= count; counter += __DYNARR_LANES)                 \
+        for (lane = 0; lane < __DYNARR_LANES; lane++)                                               \
+            lanes[lane] += array[(counter + lane) * stride];                                        \
+                                                                                                    \
+    for (lane = 0; lane < __DYNARR_LANES; lane++)                                                   \
+        sum += lanes[lane];                                                                         \
+                                                                                                    \
+    for (; counter < count; counter++)                                                              \
+        sum += array[counter * stride];                                                             \
+                                                                                                    \
+    return sum;                                                                                     \
+}                                                                                                   \
+                                                                                                    \
+__DYNARR_DEFINE_STRIDED(ACC, __Dynarr_SimpleSum##Name, __Dynarr_SimpleSum##Name##Loop, T)           \
+                                                                                                    \
+static ACC __Dynarr_PairwiseSum##Name (const T* array, size_t count, size_t stride)                 \
+{                                                                                                   \
+    if (count <= __DYNARR_PAIRWISE_BLOCK)                                                           \
+        return __Dynarr_SimpleSum##Name(array, count, stride);                                      \
+                                                                                                    \
+    return __Dynarr_PairwiseSum##Name(array, count / 2, stride)                                     \
+        + __Dynarr_PairwiseSum##Name(array + (count / 2) * stride, count - count / 2, stride);      \
+}                                                                                                   \
+                                                                                                    \
+__DYNARR_KERNEL ACC __Dynarr_KahanSum##Name##Loop (const T* array, size_t count, size_t stride)     \
+{                                                                                                   \
+    ACC lanes[__DYNARR_LANES] = {0}, errors[__DYNARR_LANES] = {0}, sum = 0, error = 0, term, total; \
+    size_t counter, lane;                                                                           \
+                                                                                                    \
+    for (counter = 0; counter + __DYNARR_LANES <= count; counter += __DYNARR_LANES)                 \
+    {                                                                                               \
+        for (lane = 0; lane < __DYNARR_LANES; lane++)                                               \
+        {                                                                                           \
+            term = array[(counter + lane) * stride] - errors[lane];                                 \
+            total = lanes[lane] + term;                                                             \
+            errors[lane] = (total - lanes[lane]) - term;                                            \
+            lanes[lane] = total;                                                                    \
+        }                                                                                           \
+    }                                                                                               \
+                                                                                                    \
+    /* Merge the lanes and the leftovers with the same compensation */                              \
+    for (lane = 0; lane < __DYNARR_LANES + count - counter; lane++)                                 \
+    {                                                                                               \
+        term = ((lane < __DYNARR_LANES) ? lanes[lane] - errors[lane] : array[(counter + lane - __DYNARR_LANES) * stride]) - error; \
+        total = sum + term;                                                                         \
+        error = (total - sum) - term;                                                               \
+        sum = total;                                                                                \
+    }                                                                                               \
+                                                                                                    \
+    return sum;                                                                                     \
+}                                                                                                   \
+                                                                                                    \
+__DYNARR_DEFINE_STRIDED(ACC, __Dynarr_KahanSum##Name, __Dynarr_KahanSum##Name##Loop, T)             \
+                                                                                                    \
+static ACC __Dynarr_Sum##Name (const T* array, size_t count, size_t stride, enum DynarrSummation summation) \
+{                                                                                                   \
+    switch (summation)                                                                              \
+    {                                                                                               \
+        case DynSumPairwise:    return __Dynarr_PairwiseSum##Name(array, count, stride);            \
+        case DynSumKahan:       return __Dynarr_KahanSum##Name(array, count, stride);               \
+        default:                return __Dynarr_SimpleSum##Name(array, count, stride);              \
+    }                                                                                               \
+}
 
-        case UChar:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%c%s", ((unsigned char*)sarray->Array)[counter], delimiter);
-            break;
+/** \brief Defines the arg-min and arg-max kernels of a numeric type.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNARR_DEFINE_MINMAX(Name, T)                                                             \
+    __DYNARR_DEFINE_ARGBEST(Min##Name, T, __DYNARR_ASCENDING)                                       \
+    __DYNARR_DEFINE_ARGBEST(Max##Name, T, __DYNARR_DESCENDING)
+
+__DYNARR_DEFINE_MINMAX(Char, signed char)
+__DYNARR_DEFINE_MINMAX(Short, short)
+__DYNARR_DEFINE_MINMAX(Int, int)
+__DYNARR_DEFINE_MINMAX(Long, long)
+__DYNARR_DEFINE_MINMAX(LLong, long long)
+__DYNARR_DEFINE_MINMAX(UChar, unsigned char)
+__DYNARR_DEFINE_MINMAX(UShort, unsigned short)
+__DYNARR_DEFINE_MINMAX(UInt, unsigned int)
+__DYNARR_DEFINE_MINMAX(ULong, unsigned long)
+__DYNARR_DEFINE_MINMAX(ULLong, unsigned long long)
+__DYNARR_DEFINE_MINMAX(Float, float)
+__DYNARR_DEFINE_MINMAX(Double, double)
+__DYNARR_DEFINE_MINMAX(LDouble, long double)
+
+__DYNARR_DEFINE_SUM_INTEGER(Char, signed char)
+__DYNARR_DEFINE_SUM_INTEGER(Short, short)
+__DYNARR_DEFINE_SUM_INTEGER(Int, int)
+__DYNARR_DEFINE_SUM_INTEGER(Long, long)
+__DYNARR_DEFINE_SUM_INTEGER(LLong, long long)
+__DYNARR_DEFINE_SUM_INTEGER(UChar, unsigned char)
+__DYNARR_DEFINE_SUM_INTEGER(UShort, unsigned short)
+__DYNARR_DEFINE_SUM_INTEGER(UInt, unsigned int)
+__DYNARR_DEFINE_SUM_INTEGER(ULong, unsigned long)
+__DYNARR_DEFINE_SUM_INTEGER(ULLong, unsigned long long)
+__DYNARR_DEFINE_SUM_FLOAT(Float, float, double)
+__DYNARR_DEFINE_SUM_FLOAT(Double, double, double)
+__DYNARR_DEFINE_SUM_FLOAT(LDouble, long double, long double)
+
+/** \brief Runs the reduction kernel of a type and stores its result.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ * \param Name The name of the type in the \c DataType enum.
+ * \param T The type of the elements.
+ * \param WIDE The type the sum is stored as.
+ */
+#define __DYNARR_REDUCE_CASE(Name, T, WIDE)                                                         \
+    case Name:                                                                                      \
+        if (reduction == __DynarrSum)                                                               \
+            *(WIDE*)result = (WIDE)__Dynarr_Sum##Name(array, view->Count, view->Stride, summation); \
+        else if (reduction == __DynarrArgMin)                                                       \
+            *(size_t*)result = __Dynarr_ArgMin##Name(array, view->Count, view->Stride);             \
+        else                                                                                        \
+            *(size_t*)result = __Dynarr_ArgMax##Name(array, view->Count, view->Stride);             \
+        return 1
+
+/** \brief Reduces the elements of a numeric DynarrView to a single value.
+ * \remark The elements are read in place, however far apart they are.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] view Pointer to a DynarrView that fits in its dynamic array.
+ * \param[in] reduction The reduction to be performed.
+ * \param[out] result Pointer to the variable that will receive the result. It's a \c size_t for
+ * \c __DynarrArgMin and \c __DynarrArgMax. See DynarrSum() for the type of the sum.
+ * \param[in] summation The summation algorithm, for floating-point sums.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_Reduce (struct DynarrView* view, enum __DynarrReduction reduction, void* result, enum DynarrSummation summation)
+{
+    const void* array = view->Base->Array + (view->Offset * view->Base->TypeSize);
 
-        case UShort:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%u%s", ((unsigned short*)sarray->Array)[counter], delimiter);
-            break;
+    // Extreme values of an empty array are undefined. Its sum is zero.
+    if (view->Count == 0 && reduction != __DynarrSum)
+        return 0;
 
-        case UInt:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%u%s", ((unsigned int*)sarray->Array)[counter], delimiter);
-            break;
+    switch (view->Base->Type)
+    {
+        __DYNARR_REDUCE_CASE(Char, signed char, long long);
+        __DYNARR_REDUCE_CASE(Short, short, long long);
+        __DYNARR_REDUCE_CASE(Int, int, long long);
+        __DYNARR_REDUCE_CASE(Long, long, long long);
+        __DYNARR_REDUCE_CASE(LLong, long long, long long);
+        __DYNARR_REDUCE_CASE(UChar, unsigned char, unsigned long long);
+        __DYNARR_REDUCE_CASE(UShort, unsigned short, unsigned long long);
+        __DYNARR_REDUCE_CASE(UInt, unsigned int, unsigned long long);
+        __DYNARR_REDUCE_CASE(ULong, unsigned long, unsigned long long);
+        __DYNARR_REDUCE_CASE(ULLong, unsigned long long, unsigned long long);
+        __DYNARR_REDUCE_CASE(Float, float, double);
+        __DYNARR_REDUCE_CASE(Double, double, double);
+        __DYNARR_REDUCE_CASE(LDouble, long double, long double);
 
-        case ULong:
-            for (counter = 0; counter < sarray->Count; counter++)
-                printf("%lu%s", ((unsigned long*)sarray->Array)[counter], delimiter);
-            break;
+        default:
+            fprintf(stderr, "Error: this data type is not supported.\n");
+            return 0;
+    }
+}
 
-        case ULLong:
-            for (counter = 0; counter < sarray->Count; counter++)
-                #ifdef _WIN32
-                    __mingw_printf("%llu%s", ((unsigned long long*)sarray->Array)[counter], delimiter);
-                #else
-                    printf("%llu%s", ((unsigned long long*)sarray->Array)[counter], delimiter);
-                #endif // _WIN32
-            break;
+/** \brief Calculates the arithmetic mean of the elements of a numeric DynarrView.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] view Pointer to a DynarrView that fits in its dynamic array.
+ * \retval double
+ * \arg If successful, returns the mean of the elements.
+ * \arg Otherwise, returns zero.
+ */
+static double __Dynarr_Mean (struct DynarrView* view)
+{
+    union { long long Signed; unsigned long long Unsigned; double Double; long double LDouble; } sum;
 
-        case Var:
-            for (counter = 0; counter < sarray->Count; counter++)
-                DynvarPrint(&((Dynvar*)sarray->Array)[counter], delimiter);
-            break;
+    if (view->Count == 0 || !__Dynarr_Reduce(view, __DynarrSum, &sum, DynSumPairwise))
+        return 0;
+
+    switch (view->Base->Type)
+    {
+        case Char: case Short: case Int: case Long: case LLong:
+            return (double)sum.Signed / view->Count;
+
+        case UChar: case UShort: case UInt: case ULong: case ULLong:
+            return (double)sum.Unsigned / view->Count;
+
+        case LDouble:
+            return (double)(sum.LDouble / view->Count);
 
         default:
-            fprintf(stderr, "Error: attempted to print an unsupported data type or the array is null.\n");
-            break;
+            return sum.Double / view->Count;
     }
 }
 
+/** \brief Records that a DynamicArray has just been sorted by type.
+ * \remark Arrays of types that can't be sorted by type are marked as unsorted.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] descending Non-zero if the array has been sorted in descending order.
+ * \return \c void
+ */
+static void __Dynarr_MarkSorted (struct DynamicArray* sarray, int descending)
+{
+    if ((sarray->Type >= Char && sarray->Type <= LDouble) || sarray->Type == Var || sarray->Type == Ptr
+        || (sarray->Type == Custom && sarray->Custom->Compare))
+        sarray->Sorted = (descending) ? DynDescending : DynAscending;
+    else
+        sarray->Sorted = DynUnsorted;
+}
 
-/* Support Functions */
+/** \brief Checks if the elements that have just been written to a sorted DynamicArray kept it sorted.
+ * \details Only the written elements and their neighbors are compared. If they're out of order, the array
+ * is marked as unsorted.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] first Index of the first element that has been written.
+ * \param[in] amount Amount of elements that have been written.
+ * \return \c void
+ */
+static void __Dynarr_UpdateOrder (struct DynamicArray* sarray, size_t first, size_t amount)
+{
+    size_t counter, last;
+
+    if (sarray->Sorted == DynUnsorted || sarray->Count < 2)
+        return;
 
+    // Compare every written element with the one that follows it, starting from the one before them
+    last = (amount < sarray->Count - first) ? first + amount : sarray->Count - 1;
 
-/** \brief This function instantiates a DynamicArray struct of the data type specified by the user.
+    for (counter = (first) ? first - 1 : 0; counter < last; counter++)
+    {
+        if (__Dynarr_CompareOrder(sarray, sarray->Array + (sarray->TypeSize * counter), sarray->Array + (sarray->TypeSize * (counter + 1))) > 0)
+        {
+            sarray->Sorted = DynUnsorted;
+            return;
+        }
+    }
+}
+
+/** \brief Compares two elements of a sorted DynamicArray, according to the order of the array.
  * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[out] sarray Pointer to a DynamicArray.
- * \param[in] elements A number representing how many elements the array should be able to hold.
- * \param[in] DType An enum representing the desired data type.
+ * \param[in] sarray Pointer to a sorted DynamicArray.
+ * \param[in] first Pointer to the first element.
+ * \param[in] second Pointer to the second element.
+ * \retval int
+ * \arg Returns a negative number if <i>first</i> goes before <i>second</i>, zero if they are equivalent
+ * and a positive number otherwise.
+ */
+static int __Dynarr_CompareOrder (struct DynamicArray* sarray, const void* first, const void* second)
+{
+    int result;
+
+    if (sarray->Type == Var)
+        result = __Dynarr_CompareVar(first, second);
+    else if (sarray->Type == Custom && sarray->Custom->Compare)
+        result = sarray->Custom->Compare(first, second);
+    else
+        result = __Dynarr_CompareByType(first, second, sarray->Type, sarray->TypeSize);
+
+    return (sarray->Sorted == DynDescending) ? (result < 0) - (result > 0) : (result > 0) - (result < 0);
+}
+
+/** \brief Performs a binary search on a sorted DynamicArray.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] sarray Pointer to a sorted DynamicArray.
+ * \param[in] element The data to be searched for.
+ * \param[in] upper Zero to look for the first element that is not ordered before <i>element</i>,
+ * non-zero to look for the first element that is ordered after it.
+ * \retval size_t
+ * \arg Returns the index of the element that was found, or the amount of elements in the array if there is none.
+ */
+static size_t __Dynarr_Bound (struct DynamicArray* sarray, void* element, int upper)
+{
+    size_t low = 0, high = sarray->Count, middle;
+    int result;
+
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        result = __Dynarr_CompareOrder(sarray, sarray->Array + (sarray->TypeSize * middle), element);
+
+        if (result < 0 || (upper && result == 0))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+/** \brief Checks if a DynarrView still fits in its dynamic array.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] view Pointer to a DynarrView.
+ * \retval int
+ * \arg If every element of the view exists, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_CheckView (struct DynarrView* view)
+{
+    struct DynamicArray* base = view->Base;
+
+    // The viewed array may have shrunk since the view was created
+    if (view->Count > 0 && (view->Offset >= base->Count || (base->Count - view->Offset - 1) / view->Stride < view->Count - 1))
+    {
+        fprintf(stderr, "Error: the view exceeds the bounds of its dynamic array.\n");
+        return 0;
+    }
+
+    return 1;
+}
+
+/** \brief Exposes adjacent elements of a DynarrView as a DynamicArray that can be passed to the read functions.
+ * \details The DynamicArray points straight into the viewed array, so it must not be modified in size or released.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] view Pointer to a DynarrView that fits in its dynamic array.
+ * \param[in] index The index in the view of the first element.
+ * \param[in] count The amount of elements to be exposed. Unless the stride of the view is one, it must be at most one.
+ * \retval struct DynamicArray
+ * \arg Returns a DynamicArray of the elements.
+ */
+static struct DynamicArray __Dynarr_ViewWindow (struct DynarrView* view, size_t index, size_t count)
+{
+    struct DynamicArray* base = view->Base;
+
+    return (struct DynamicArray){
+        .Array = base->Array + ((view->Offset + index * view->Stride) * base->TypeSize),
+        .Capacity = count,
+        .Count = count,
+        .TypeSize = base->TypeSize,
+        .Type = base->Type,
+        .Sorted = base->Sorted,     // Any subsequence of a sorted array is sorted in the same order
+        .Custom = base->Custom
+    };
+}
+
+/** \brief Sorts the elements of a DynarrView in place.
+ * \remark Only views of adjacent elements can be sorted.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] view Pointer to a DynarrView.
+ * \param[in] descending Non-zero to sort in descending order.
  * \return \c void
  */
-static void __Dynarr_NewArray (struct DynamicArray* sarray, int elements, enum DataType DType)
+static void __Dynarr_SortView (struct DynarrView* view, int descending)
 {
-    // Instantiate the right type of array
-    switch (DType)
+    struct DynamicArray window;
+
+    if (view->Stride != 1 && view->Count > 1)
     {
-        case Char:
-            sarray->Type = Char;
-            sarray->TypeSize = sizeof(signed char);
-            sarray->Array = calloc(elements, sizeof(signed char));
-            break;
+        fprintf(stderr, "Error: only views of adjacent elements can be sorted.\n");
+        return;
+    }
+    else if (view->Count < 2 || !__Dynarr_CheckView(view))
+        return;
 
-        case Short:
-            sarray->Type = Short;
-            sarray->TypeSize = sizeof(short);
-            sarray->Array = calloc(elements, sizeof(short));
-            break;
+    window = __Dynarr_ViewWindow(view, 0, view->Count);
+    __Dynarr_SortArray(&window, descending);
 
-        case Int:
-            sarray->Type = Int;
-            sarray->TypeSize = sizeof(int);
-            sarray->Array = calloc(elements, sizeof(int));
-            break;
+    // Unless the view covers the whole array, its order is no longer known
+    if (view->Count == view->Base->Count)
+        view->Base->Sorted = window.Sorted;
+    else
+        view->Base->Sorted = DynUnsorted;
+}
 
-        case Long:
-            sarray->Type = Long;
-            sarray->TypeSize = sizeof(long);
-            sarray->Array = calloc(elements, sizeof(long));
-            break;
+/** \brief Allocates a buffer for the elements of a DynamicArray.
+ * \remark Buffers with the default alignment come from \c malloc(), so they can be passed to \c realloc()
+ * and \c free(). Buffers with a bigger alignment must be handled by __Dynarr_Reallocate() and __Dynarr_FreeBuffer().
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] alignment The alignment of the buffer, in bytes. Zero for the default alignment.
+ * \param[in] bytes The size of the buffer, in bytes.
+ * \retval void*
+ * \arg If successful, returns a pointer to the zero-initialized buffer.
+ * \arg Otherwise, returns a null pointer.
+ */
+static void* __Dynarr_Allocate (size_t alignment, size_t bytes)
+{
+    void* buffer;
 
-        case LLong:
-            sarray->Type = LLong;
-            sarray->TypeSize = sizeof(long long);
-            sarray->Array = calloc(elements, sizeof(long long));
-            break;
+    if (alignment <= _Alignof(max_align_t))
+        return calloc(bytes ? bytes : 1, 1);
 
-        case Float:
-            sarray->Type = Float;
-            sarray->TypeSize = sizeof(float);
-            sarray->Array = calloc(elements, sizeof(float));
-            break;
+    // The size of an aligned buffer must be a multiple of its alignment
+    if (bytes > SIZE_MAX - alignment)
+        return NULL;
 
-        case Double:
-            sarray->Type = Double;
-            sarray->TypeSize = sizeof(double);
-            sarray->Array = calloc(elements, sizeof(double));
-            break;
+    bytes = (bytes + alignment - 1) & ~(alignment - 1);
+
+    #ifdef _WIN32
+        buffer = _aligned_malloc(bytes ? bytes : alignment, alignment);
+    #else
+        buffer = aligned_alloc(alignment, bytes ? bytes : alignment);
+    #endif // _WIN32
+
+    if (!buffer)
+        return NULL;
+
+    // Ask for huge pages before the buffer is touched, so they back it from the start
+    #if defined(__DYNARR_MMAP) && defined(MADV_HUGEPAGE)
+        if (alignment >= DYNARR_HUGE_PAGE_SIZE && bytes > 0)
+            madvise(buffer, bytes, MADV_HUGEPAGE);
+    #endif // __DYNARR_MMAP
+
+    memset(buffer, 0, bytes);
+
+    return buffer;
+}
+
+/** \brief Resizes a buffer that was allocated by __Dynarr_Allocate().
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] alignment The alignment of the buffer, in bytes. Zero for the default alignment.
+ * \param[in] buffer Pointer to the buffer.
+ * \param[in] used Amount of bytes at the beginning of the buffer that must be preserved.
+ * \param[in] bytes The new size of the buffer, in bytes.
+ * \retval void*
+ * \arg If successful, returns a pointer to the resized buffer. The old pointer must not be used anymore.
+ * \arg Otherwise, returns a null pointer and the old buffer is left untouched.
+ */
+static void* __Dynarr_Reallocate (size_t alignment, void* buffer, size_t used, size_t bytes)
+{
+    void* resized;
+
+    if (alignment <= _Alignof(max_align_t))
+        return realloc(buffer, bytes);
+
+    // realloc() doesn't preserve the alignment, so move the data to a new buffer
+    if (!(resized = __Dynarr_Allocate(alignment, bytes)))
+        return NULL;
+
+    if (buffer)
+    {
+        memcpy(resized, buffer, (used < bytes) ? used : bytes);
+        __Dynarr_FreeBuffer(alignment, buffer);
+    }
+
+    return resized;
+}
+
+/** \brief Deallocates a buffer that was allocated by __Dynarr_Allocate().
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] alignment The alignment of the buffer, in bytes. Zero for the default alignment.
+ * \param[in] buffer Pointer to the buffer. Can be NULL.
+ * \return \c void
+ */
+static void __Dynarr_FreeBuffer (size_t alignment, void* buffer)
+{
+    #ifdef _WIN32
+        if (alignment > _Alignof(max_align_t))
+        {
+            _aligned_free(buffer);
+            return;
+        }
+    #else
+        (void)alignment;
+    #endif // _WIN32
 
-        case LDouble:
-            sarray->Type = LDouble;
-            sarray->TypeSize = sizeof(long double);
-            sarray->Array = calloc(elements, sizeof(long double));
-            break;
+    free(buffer);
+}
 
-        case UChar:
-            sarray->Type = UChar;
-            sarray->TypeSize = sizeof(unsigned char);
-            sarray->Array = calloc(elements, sizeof(unsigned char));
-            break;
+/** \brief Copies elements into a DynamicArray, deep copying them if their type requires it.
+ * \details Dynamic variables get their own copy of their data. Custom elements are copied with the copy
+ * function of their type, if there is one. Everything else is copied as a single block.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] sarray Pointer to the DynamicArray the elements are copied into.
+ * \param[out] destination Pointer to the uninitialized elements of <i>sarray</i> that will receive the copies.
+ * \param[in] source Pointer to the elements to be copied. They must not overlap <i>destination</i>.
+ * \param[in] amount The amount of elements to be copied.
+ * \return \c void
+ */
+static void __Dynarr_CopyElements (struct DynamicArray* sarray, void* destination, const void* source, size_t amount)
+{
+    size_t counter;
 
-        case UShort:
-            sarray->Type = UShort;
-            sarray->TypeSize = sizeof(unsigned short);
-            sarray->Array = calloc(elements, sizeof(unsigned short));
-            break;
+    if (sarray->Type == Var)
+    {
+        for (counter = 0; counter < amount; counter++)
+            ((Dynvar*)destination)[counter] = DynvarCopy((Dynvar*)source + counter);
+    }
+    else if (sarray->Type == Custom && sarray->Custom->Copy)
+    {
+        for (counter = 0; counter < amount; counter++)
+            sarray->Custom->Copy(destination + (counter * sarray->TypeSize), source + (counter * sarray->TypeSize));
+    }
+    else
+    {
+        memcpy(destination, source, amount * sarray->TypeSize);
+    }
+}
 
-        case UInt:
-            sarray->Type = UInt;
-            sarray->TypeSize = sizeof(unsigned int);
-            sarray->Array = calloc(elements, sizeof(unsigned int));
-            break;
+/** \brief Releases the resources owned by a range of elements of a DynamicArray.
+ * \details Dynamic variables have their data deallocated. Custom elements are released with the destroy
+ * function of their type, if there is one. Nothing happens to elements of other types.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sarray Pointer to a DynamicArray.
+ * \param[in] first The index of the first element to be released.
+ * \param[in] amount The amount of elements to be released.
+ * \return \c void
+ */
+static void __Dynarr_ReleaseElements (struct DynamicArray* sarray, size_t first, size_t amount)
+{
+    size_t counter;
 
-        case ULong:
-            sarray->Type = ULong;
-            sarray->TypeSize = sizeof(unsigned long);
-            sarray->Array = calloc(elements, sizeof(unsigned long));
-            break;
+    if (sarray->Type == Var)
+    {
+        for (counter = first; counter < first + amount; counter++)
+            DynvarClear(&((Dynvar*)sarray->Array)[counter]);
+    }
+    else if (sarray->Type == Custom && sarray->Custom->Destroy)
+    {
+        for (counter = first; counter < first + amount; counter++)
+            sarray->Custom->Destroy(sarray->Array + (counter * sarray->TypeSize));
+    }
+}
 
-        case ULLong:
-            sarray->Type = ULLong;
-            sarray->TypeSize = sizeof(unsigned long long);
-            sarray->Array = calloc(elements, sizeof(unsigned long long));
-            break;
+/** \brief Checks if two DynamicArrays store elements of the same type.
+ * \remark Arrays of custom data must share the same description of their elements.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] first Pointer to a DynamicArray.
+ * \param[in] second Pointer to another DynamicArray.
+ * \retval int
+ * \arg Returns non-zero if both arrays store elements of the same type.
+ * \arg Otherwise, returns zero.
+ */
+static int __Dynarr_SameType (struct DynamicArray* first, struct DynamicArray* second)
+{
+    return first->Type == second->Type && first->TypeSize == second->TypeSize && first->Custom == second->Custom;
+}
 
-        case Var:
-            sarray->Type = Var;
-            sarray->TypeSize = sizeof(Dynvar);
-            sarray->Array = calloc(elements, sizeof(Dynvar));
-            break;
+/** \brief Instantiates an empty DynamicArray that stores elements of the same type as another one.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] model Pointer to the DynamicArray whose type is copied.
+ * \param[in] initialCapacity The amount of elements the new array should initially be able to store.
+ * \retval struct DynamicArray
+ * \arg Returns the output of NewDynamicArray() or NewDynamicArrayCustom().
+ */
+static struct DynamicArray __Dynarr_NewLike (struct DynamicArray* model, size_t initialCapacity)
+{
+    if (model->Type == Custom)
+        return NewDynamicArrayCustom(initialCapacity, model->Custom);
 
-        case Ptr:
-            sarray->Type = Ptr;
-            sarray->TypeSize = sizeof(void*);
-            sarray->Array = calloc(elements, sizeof(void*));
-            break;
+    return (model->Alignment)
+        ? NewDynamicArrayAligned(initialCapacity, model->Type, model->Alignment)
+        : NewDynamicArray(initialCapacity, model->Type);
+}
 
-        default:
-            fprintf(stderr, "Error: unrecognized type. A null array was generated.\n");
-            sarray->Capacity = 0;
-            sarray->Type = 0;
-            sarray->TypeSize = 0;
-            sarray->Array = NULL;
-            break;
+/** \brief Reverses the order of the elements of an array of any type.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] array Pointer to the array.
+ * \param[in] count The amount of elements in the array.
+ * \param[in] size The size of each element, in bytes.
+ * \return \c void
+ */
+static void __Dynarr_Reverse (void* array, size_t count, size_t size)
+{
+    unsigned char swap[64];
+    size_t low, high, offset, chunk;
+
+    for (low = 0, high = count - 1; low < high && count > 0; low++, high--)
+    {
+        // Swap both elements in chunks, as they can be of any size
+        for (offset = 0; offset < size; offset += chunk)
+        {
+            chunk = (size - offset < sizeof(swap)) ? size - offset : sizeof(swap);
+            memcpy(swap, array + (low * size) + offset, chunk);
+            memcpy(array + (low * size) + offset, array + (high * size) + offset, chunk);
+            memcpy(array + (high * size) + offset, swap, chunk);
+        }
     }
 }
 
-/** \brief Removes an element from the a DynamicArray at the specified index.
- * \remark This is achieved by shifting the array from the provided index until it
- * reaches the end.
+/** \brief Changes the capacity of a DynamicArray, wherever its elements are stored.
+ * \details Heap arrays are reallocated. Mapped arrays have their file resized and are remapped, which
+ * may move them to another address without copying any data. Inline arrays move to the heap once they
+ * no longer fit in their inline buffer.
  * \warning <u>This is a private function and is not meant to be directly invoked!</u>
  * \param[out] sarray Pointer to a DynamicArray.
- * \param[in] index The index of the element to be removed.
+ * \param[in] capacity The new capacity of the array. It must not be smaller than its amount of elements.
  * \retval int
- * \arg If successful, returns the amount of shifted elements.
- * \arg Otherwise, returns zero.
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero and the array is left untouched.
  */
-static int __Dynarr_RemoveElement (struct DynamicArray* sarray, int index)
+static int __Dynarr_Resize (struct DynamicArray* sarray, size_t capacity)
 {
-    int counter;
-    void* atIndex = sarray->Array + (index * sarray->TypeSize);
-    void* scout = atIndex + sarray->TypeSize;
+    void* tempPointer;
 
-    switch (sarray->Type)
-    {
-        case Char:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(signed char), scout += sizeof(signed char))
-                *(signed char*)atIndex = *(signed char*)scout;
-            break;
+    #if DYNARR_INLINE_SIZE > 0
+        if (sarray->Storage == DynInline)
+        {
+            if (capacity <= sizeof(sarray->Inline) / sarray->TypeSize)
+            {
+                sarray->Capacity = capacity;
+                return 1;
+            }
 
-        case Short:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(short), scout += sizeof(short))
-                *(short*)atIndex = *(short*)scout;
-            break;
+            if (!(tempPointer = __Dynarr_Allocate(sarray->Alignment, capacity * sarray->TypeSize)))
+                return 0;
 
-        case Int:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(int), scout += sizeof(int))
-                *(int*)atIndex = *(int*)scout;
-            break;
+            memcpy(tempPointer, sarray->Array, sarray->Count * sarray->TypeSize);
 
-        case Long:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(long), scout += sizeof(long))
-                *(long*)atIndex = *(long*)scout;
-            break;
+            sarray->Array = tempPointer;
+            sarray->Capacity = capacity;
+            sarray->Storage = DynHeap;
 
-        case LLong:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(long long), scout += sizeof(long long))
-                *(long long*)atIndex = *(long long*)scout;
-            break;
+            return 1;
+        }
+    #endif // DYNARR_INLINE_SIZE
 
-        case Float:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(float), scout += sizeof(float))
-                *(float*)atIndex = *(float*)scout;
-            break;
+    #ifdef __DYNARR_MMAP
+        if (sarray->Storage == DynCopyOnWrite)
+        {
+            // The private mapping can't grow, so move the elements to the heap for good
+            if (!(tempPointer = __Dynarr_Allocate(0, capacity * sarray->TypeSize)))
+                return 0;
 
-        case Double:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(double), scout += sizeof(double))
-                *(double*)atIndex = *(double*)scout;
-            break;
+            memcpy(tempPointer, sarray->Array, sarray->Count * sarray->TypeSize);
+            __Dynarr_Unmap(sarray);
 
-        case LDouble:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(long double), scout += sizeof(long double))
-                *(long double*)atIndex = *(long double*)scout;
-            break;
+            sarray->Array = tempPointer;
+            sarray->Capacity = capacity;
+            sarray->Storage = DynHeap;
 
-        case UChar:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(unsigned char), scout += sizeof(unsigned char))
-                *(unsigned char*)atIndex = *(unsigned char*)scout;
-            break;
+            return 1;
+        }
+        else if (sarray->Storage == DynMapped)
+        {
+            size_t oldLength = sizeof(struct __DynarrMapHeader) + (sarray->Capacity * sarray->TypeSize);
+            size_t newLength = sizeof(struct __DynarrMapHeader) + (capacity * sarray->TypeSize);
 
-        case UShort:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(unsigned short), scout += sizeof(unsigned short))
-                *(unsigned short*)atIndex = *(unsigned short*)scout;
-            break;
+            // The file must be big enough for the whole mapping before it's accessed
+            if (newLength > oldLength && ftruncate(sarray->File, newLength) != 0)
+                return 0;
 
-        case UInt:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(unsigned int), scout += sizeof(unsigned int))
-                *(unsigned int*)atIndex = *(unsigned int*)scout;
-            break;
+            tempPointer = mremap(sarray->Array - sizeof(struct __DynarrMapHeader), oldLength, newLength, MREMAP_MAYMOVE);
 
-        case ULong:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(unsigned long), scout += sizeof(unsigned long))
-                *(unsigned long*)atIndex = *(unsigned long*)scout;
-            break;
+            if (tempPointer == MAP_FAILED)
+            {
+                // Give the extra space back. The old mapping stays valid even if that fails
+                if (newLength > oldLength && ftruncate(sarray->File, oldLength) != 0)
+                    fprintf(stderr, "Error: failed to restore the size of the file of the dynamic array.\n");
 
-        case ULLong:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(unsigned long long), scout += sizeof(unsigned long long))
-                *(unsigned long long*)atIndex = *(unsigned long long*)scout;
-            break;
+                return 0;
+            }
 
-        case Var:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(Dynvar), scout += sizeof(Dynvar))
-                *(Dynvar*)atIndex = *(Dynvar*)scout;
-            break;
+            // Shrink the file once the mapping no longer covers the extra space
+            if (newLength < oldLength && ftruncate(sarray->File, newLength) != 0)
+                fprintf(stderr, "Error: failed to shrink the file of the dynamic array.\n");
 
-        case Ptr:
-            for (counter = 0; index < sarray->Count - 1; counter++, index++, atIndex += sizeof(void*), scout += sizeof(void*))
-                atIndex = scout;
-            break;
+            sarray->Array = tempPointer + sizeof(struct __DynarrMapHeader);
+            sarray->Capacity = capacity;
 
-        default:
-            fprintf(stderr, "Error: this data type is not supported.\n");
-            counter = 0;
-            break;
-    }
+            return 1;
+        }
+    #endif // __DYNARR_MMAP
+
+    tempPointer = __Dynarr_Reallocate(sarray->Alignment, sarray->Array, sarray->Count * sarray->TypeSize, capacity * sarray->TypeSize);
+
+    if (!tempPointer)
+        return 0;
 
-    return counter;
+    sarray->Array = tempPointer;
+    sarray->Capacity = capacity;
+
+    return 1;
 }
 
-/** \brief This function is a wrapper for the \c qsort() standard function for a simple ascending sort.
+/** \brief Returns the size of the elements of the types that can be stored without a custom description.
  * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[out] sarray Pointer to a DynamicArray.
- * \param[in] compar
- * \parblock
- * Pointer to a function that compares two values of any type and returns an \c int that is:
- * <br> <u>Less than zero</u>, if first value is less than second value.
- * <br> <u>Zero</u>, if first value is equal to second value.
- * <br> <u>Greater than zero</u>, if first value is greater than second value.
- * \endparblock
+ * \param[in] DType The data type.
+ * \retval size_t
+ * \arg Returns the size of the integer, floating-point, dynamic variable and pointer types, in bytes.
+ * \arg Returns zero for any other type.
+ */
+static size_t __Dynarr_ElementSize (enum DataType DType)
+{
+    switch (DType)
+    {
+        case Var:   return sizeof(struct DynamicVariable);
+        case Ptr:   return sizeof(void*);
+        default:    return __Dyn_SizeOf(DType);
+    }
+}
+
+/** \brief Unmaps the elements of a DynamicArray that is not stored in the heap.
+ * \details Mapped arrays have their amount of elements saved to their file, which is then closed.
+ * Copy-on-write arrays just have their private mapping discarded.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] sarray Pointer to a mapped or copy-on-write DynamicArray.
  * \return \c void
  */
-static void __Dynarr_SortArray (struct DynamicArray* sarray, int (*compar)(const void*, const void*))
+static void __Dynarr_Unmap (struct DynamicArray* sarray)
 {
-    __dynarr_GlobalComparType = sarray->Type;
-    qsort(sarray->Array, sarray->Count, sarray->TypeSize, compar);
+    #ifdef __DYNARR_MMAP
+        struct __DynarrMapHeader* header = sarray->Array - sizeof(struct __DynarrMapHeader);
+
+        if (sarray->Storage == DynCopyOnWrite)
+        {
+            munmap(sarray->Array - sizeof(struct __DynarrSaveHeader), sizeof(struct __DynarrSaveHeader) + (sarray->Capacity * sarray->TypeSize));
+            return;
+        }
+
+        header->Count = sarray->Count;
+        header->Sorted = sarray->Sorted;
+
+        munmap(header, sizeof(struct __DynarrMapHeader) + (sarray->Capacity * sarray->TypeSize));
+        close(sarray->File);
+    #else
+        (void)sarray;
+    #endif // __DYNARR_MMAP
 }
 
-/** \brief This function is a wrapper for the __Dynarr_CompareByType() function.
- * \remark It takes it's returned value and inverts it by multiplying it to -1.
+/** \brief Starts the calculation of a checksum.
  * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[in] first Pointer to the first value.
- * \param[in] second Pointer to the second value.
- * \retval int
- * \arg Returns the output of __Dynarr_CompareByType() multiplied by -1.
+ * \param[out] checksum Pointer to the state of the checksum.
+ * \return \c void
  */
-static int __Dynarr_CompareByTypeDesc (const void* first, const void* second)
+static void __Dynarr_ChecksumStart (struct __DynarrChecksum* checksum)
 {
-    return __Dynarr_CompareByType(first, second) * -1;
+    *checksum = (struct __DynarrChecksum){ .Lanes = { 0xCBF29CE484222325ULL, 0x84222325CBF29CE4ULL, 0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL } };
 }
 
-/** \brief This function is used as a <i>compar</i> function on \c qsort() for simple
- * sortings. It takes two values of any type and subtracts them with each other.
- * \remark If the result is greater than zero, it means that the first value is greater than
- * the second one and vice-versa. If result is equal to zero, both values are equal.
+/** \brief Reads 8 bytes as a little-endian integer, regardless of the byte order of the machine.
  * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[in] first Pointer to the first value.
- * \param[in] second Pointer to the second value.
- * \retval int
- * \arg Returns the subtraction between the first and second values.
  */
-static int __Dynarr_CompareByType (const void* first, const void* second)
+static inline uint64_t __Dynarr_ReadWord (const void* bytes)
 {
-    switch (__dynarr_GlobalComparType)
-    {
-        case Char:
-            return *(signed char*)first - *(signed char*)second;
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
 
-        case Short:
-            return *(short*)first - *(short*)second;
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+    #endif // __BYTE_ORDER__
 
-        case Int:
-            return *(int*)first - *(int*)second;
+    return word;
+}
 
-        case Long:
-            return *(long*)first - *(long*)second;
+/** \brief Adds bytes to a checksum.
+ * \details The bytes are hashed as 8-byte words spread across 4 independent lanes, so the hashes can be
+ * computed in parallel by the processor. The result only depends on the bytes, not on how they're split
+ * between calls, nor on the byte order of the machine.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] checksum Pointer to the state of the checksum.
+ * \param[in] data Pointer to the bytes.
+ * \param[in] bytes The amount of bytes.
+ * \return \c void
+ */
+static void __Dynarr_ChecksumUpdate (struct __DynarrChecksum* checksum, const void* data, size_t bytes)
+{
+    const uint8_t* input = data;
+    size_t taken, lane;
 
-        case LLong:
-            return *(long long*)first - *(long long*)second;
+    checksum->Length += bytes;
 
-        case Float:
-            return *(float*)first - *(float*)second;
+    // Complete the pending block first
+    if (checksum->PendingBytes)
+    {
+        taken = (bytes < sizeof(checksum->Pending) - checksum->PendingBytes) ? bytes : sizeof(checksum->Pending) - checksum->PendingBytes;
+        memcpy(checksum->Pending + checksum->PendingBytes, input, taken);
+        checksum->PendingBytes += taken;
+        input += taken;
+        bytes -= taken;
 
-        case Double:
-            return *(double*)first - *(double*)second;
+        if (checksum->PendingBytes < sizeof(checksum->Pending))
+            return;
 
-        case LDouble:
-            return *(long double*)first - *(long double*)second;
+        for (lane = 0; lane < 4; lane++)
+            checksum->Lanes[lane] = ((checksum->Lanes[lane] ^ __Dynarr_ReadWord(checksum->Pending + (lane * 8))) * 0x100000001B3ULL) ^ (checksum->Lanes[lane] >> 29);
 
-        case UChar:
-            return *(unsigned char*)first - *(unsigned char*)second;
+        checksum->PendingBytes = 0;
+    }
 
-        case UShort:
-            return *(unsigned short*)first - *(unsigned short*)second;
+    for (; bytes >= sizeof(checksum->Pending); input += sizeof(checksum->Pending), bytes -= sizeof(checksum->Pending))
+    {
+        for (lane = 0; lane < 4; lane++)
+            checksum->Lanes[lane] = ((checksum->Lanes[lane] ^ __Dynarr_ReadWord(input + (lane * 8))) * 0x100000001B3ULL) ^ (checksum->Lanes[lane] >> 29);
+    }
 
-        case UInt:
-            return *(unsigned int*)first - *(unsigned int*)second;
+    memcpy(checksum->Pending, input, bytes);
+    checksum->PendingBytes = bytes;
+}
 
-        case ULong:
-            return *(unsigned long*)first - *(unsigned long*)second;
+/** \brief Finishes the calculation of a checksum.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] checksum Pointer to the state of the checksum.
+ * \retval uint64_t
+ * \arg Returns the checksum of all bytes added to it.
+ */
+static uint64_t __Dynarr_ChecksumFinish (struct __DynarrChecksum* checksum)
+{
+    uint64_t result = checksum->Length;
+    size_t counter;
 
-        case ULLong:
-            return *(unsigned long long*)first - *(unsigned long long*)second;
+    for (counter = 0; counter < 4; counter++)
+        result = (result ^ checksum->Lanes[counter]) * 0x9E3779B97F4A7C15ULL;
 
-        case Var:
-            // If the variables store data of the same type
-            if (*(unsigned short*)(first + sizeof(void*)) == *(unsigned short*)(second + sizeof(void*)))
-            {
-                // Sort by value
-                return memcmp(first, second, *(unsigned short*)(first + sizeof(void*) + sizeof(unsigned short)));
-            }
-            else // If they don't store data of the same type
-            {
-                // Sort by type
-                return *(unsigned short*)(first + sizeof(void*)) - *(unsigned short*)(second + sizeof(void*));
-            }
+    // The leftover bytes are hashed one at a time
+    for (counter = 0; counter < checksum->PendingBytes; counter++)
+        result = (result ^ checksum->Pending[counter]) * 0x100000001B3ULL;
 
-        default:
-            // If data type is not supported, don't do anything
-            return 0;
-    }
+    return result ^ (result >> 31);
 }
 
-/** \brief This function compares the value stored in 2 DynamicVariables with each other.
- * \remark If the result is greater than zero, it means that the first value is greater than
- * the second one and vice-versa. If result is equal to zero, both values are equal.
+/** \brief Reads and validates the header of a file written by DynarrSave().
+ * \details If the file was saved by a machine with a different byte order, the fields of the header are
+ * converted to the byte order of this machine.
  * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[in] first Pointer to the first DynamicVariable.
- * \param[in] second Pointer to the second DynamicVariable.
+ * \param[out] header Pointer to the header that will receive the contents of the file.
+ * \param[in] file The file, positioned at its beginning.
  * \retval int
- * \arg Returns zero if both values match.
- * \arg Otherwise, returns any non-zero number.
+ * \arg Returns 1 if the header is valid and the file has the byte order of this machine.
+ * \arg Returns 2 if the header is valid but the file has the opposite byte order.
+ * \arg Returns 0 if the header is not valid.
  */
-static int __Dynarr_VarCmp (struct DynamicVariable* first, struct DynamicVariable* second)
+static int __Dynarr_ReadSaveHeader (struct __DynarrSaveHeader* header, FILE* file)
 {
-    // This function could be discarded if I reorganize the Dynarr struct and check
-    // for the type with basic pointer arithmetic on __Dynarr_CompareByType(), but
-    // I can't be bothered
-    switch (second->Type)
+    int swapped = 0;
+    size_t typeSize;
+
+    if (fread(header, sizeof(*header), 1, file) != 1 || memcmp(header->Magic, __DYNARR_SAVE_MAGIC, sizeof(header->Magic)))
+        return 0;
+
+    if (header->ByteOrder == __builtin_bswap32(__DYNARR_BYTE_ORDER))
     {
-        // This weird amalgamation is to prevent chars from being matched with
-        // strings and vice-versa
-        case String:
-            if (first->Type == second->Type)
-                return strcmp(first->Data, second->Data);
+        swapped = 1;
+        header->Version = __builtin_bswap16(header->Version);
+        header->Type = __builtin_bswap16(header->Type);
+        header->Sorted = __builtin_bswap16(header->Sorted);
+        header->TypeSize = __builtin_bswap64(header->TypeSize);
+        header->Count = __builtin_bswap64(header->Count);
+        header->DataSize = __builtin_bswap64(header->DataSize);
+        header->Checksum = __builtin_bswap64(header->Checksum);
+    }
+    else if (header->ByteOrder != __DYNARR_BYTE_ORDER)
+    {
+        return 0;
+    }
 
-        case Char:
-        case UChar:
-            if (first->Size != second->Size)
-                return -1;
+    typeSize = (header->Type == Var) ? sizeof(struct DynamicVariable) : __Dyn_SizeOf(header->Type);
 
-        default: // The ternary is necessary to prevent unallocated bytes from being read in case one type is bigger than another
-            return memcmp(first->Data, second->Data, (first->Size < second->Size) ? first->Size : second->Size);
+    // The elements must have the same layout on this machine
+    if (header->Version != __DYNARR_SAVE_VERSION || typeSize == 0 || header->TypeSize != typeSize || header->Sorted > DynDescending
+        || header->DataSize > SIZE_MAX - sizeof(*header))
+    {
+        return 0;
+    }
+
+    // The elements must fill the data exactly. Each dynamic variable takes at least its type and size.
+    if ((header->Type != Var && (header->DataSize % typeSize != 0 || header->Count != header->DataSize / typeSize))
+        || (header->Type == Var && header->Count > header->DataSize / (sizeof(uint16_t) + sizeof(uint32_t))))
+    {
+        return 0;
+    }
+
+    return 1 + swapped;
+}
+
+/** \brief Reverses the bytes of each element of an array, converting them to the opposite byte order.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] array Pointer to the array.
+ * \param[in] count The amount of elements in the array.
+ * \param[in] size The size of each element, in bytes.
+ * \return \c void
+ */
+static void __Dynarr_SwapBytes (void* array, size_t count, size_t size)
+{
+    uint8_t* element = array, swap;
+    size_t counter, low, high;
+
+    for (counter = 0; counter < count; counter++, element += size)
+    {
+        for (low = 0, high = size - 1; low < high; low++, high--)
+        {
+            swap = element[low];
+            element[low] = element[high];
+            element[high] = swap;
+        }
     }
 }
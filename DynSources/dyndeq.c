@@ -0,0 +1,418 @@
+#include "../DynHeaders/dyndeq.h"
+#include "../DynHeaders/dynsize.h"
+
+
+/* Private Functions */
+
+
+static size_t __Dyndeq_SizeOf (enum DataType);
+static int __Dyndeq_Grow (struct DynamicDeque*, size_t);
+static void __Dyndeq_CopyIn (struct DynamicDeque*, size_t, const void*, size_t);
+static void __Dyndeq_CopyOut (struct DynamicDeque*, size_t, void*, size_t);
+static void __Dyndeq_Release (struct DynamicDeque*, size_t, size_t);
+
+/** \brief Returns the position in the buffer of the element at the specified index of a DynamicDeque.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNDEQ_SLOT(sdeque, index) (((sdeque)->Head + (index)) & ((sdeque)->Capacity - 1))
+
+
+/* Public Functions */
+
+
+/** \brief Initializes an object of type DynamicDeque according to the specified data type.
+ * \remark Only integer, floating-point, dynamic variable and pointer types are supported.
+ * \param[in] initialCapacity The amount of elements the deque should initially be able to store.
+ * It's rounded up to a power of 2.
+ * \param[in] DType The data type of the elements to be stored in the deque.
+ * \retval struct DynamicDeque
+ * \arg If successful, the DynamicDeque will contain a pointer to the allocated buffer.
+ * \arg Otherwise, the DynamicDeque will contain a null pointer.
+ */
+struct DynamicDeque NewDynamicDeque (size_t initialCapacity, enum DataType DType)
+{
+    struct DynamicDeque sdeque = { .Type = DType, .TypeSize = __Dyndeq_SizeOf(DType) };
+
+    if (sdeque.TypeSize == 0)
+    {
+        fprintf(stderr, "Error: unrecognized type. A null deque was generated.\n");
+        sdeque.Type = 0;
+        return sdeque;
+    }
+
+    // If initial capacity is invalid, set it to default
+    if (initialCapacity == 0)
+        initialCapacity = 16;
+
+    if (!__Dyndeq_Grow(&sdeque, initialCapacity))
+    {
+        fprintf(stderr, "Error: failed to allocate memory for the new dynamic deque.\n");
+        DyndeqClear(&sdeque);
+    }
+
+    return sdeque;
+}
+
+/** \brief Adds an element to the end of a DynamicDeque.
+ * \details Dynamic variables are deep copied.
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[in] newElement Pointer to the element to be added.
+ * \retval size_t
+ * \arg If successful, returns the amount of elements contained in the deque.
+ * \arg Otherwise, returns zero.
+ */
+size_t DyndeqPushBack (struct DynamicDeque* sdeque, void* newElement)
+{
+    return DyndeqEnqueue(sdeque, newElement, 1);
+}
+
+/** \brief Adds an element to the beginning of a DynamicDeque.
+ * \details Dynamic variables are deep copied.
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[in] newElement Pointer to the element to be added.
+ * \retval size_t
+ * \arg If successful, returns the amount of elements contained in the deque.
+ * \arg Otherwise, returns zero.
+ */
+size_t DyndeqPushFront (struct DynamicDeque* sdeque, void* newElement)
+{
+    if (sdeque->Type == 0)
+    {
+        fprintf(stderr, "Error: attempted to add an element to a null dynamic deque.\n");
+        return 0;
+    }
+    else if (!__Dyndeq_Grow(sdeque, sdeque->Count + 1))
+    {
+        fprintf(stderr, "Error: failed to add an element to the dynamic deque.\n");
+        return 0;
+    }
+
+    sdeque->Head = (sdeque->Head - 1) & (sdeque->Capacity - 1);
+    sdeque->Count++;
+    __Dyndeq_CopyIn(sdeque, 0, newElement, 1);
+
+    return sdeque->Count;
+}
+
+/** \brief Removes the last element of a DynamicDeque.
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[out] output Pointer to the memory that will receive the removed element. Dynamic variables are handed
+ * over, so the caller must clear them. If NULL, the element is simply discarded.
+ * \retval int
+ * \arg If the deque wasn't empty, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DyndeqPopBack (struct DynamicDeque* sdeque, void* output)
+{
+    if (sdeque->Count == 0)
+        return 0;
+
+    if (output)
+        __Dyndeq_CopyOut(sdeque, sdeque->Count - 1, output, 1);
+    else
+        __Dyndeq_Release(sdeque, sdeque->Count - 1, 1);
+
+    sdeque->Count--;
+
+    return 1;
+}
+
+/** \brief Removes the first element of a DynamicDeque.
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[out] output Pointer to the memory that will receive the removed element. Dynamic variables are handed
+ * over, so the caller must clear them. If NULL, the element is simply discarded.
+ * \retval int
+ * \arg If the deque wasn't empty, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DyndeqPopFront (struct DynamicDeque* sdeque, void* output)
+{
+    return DyndeqDequeue(sdeque, output, 1) == 1;
+}
+
+/** \brief Returns a pointer to the last element of a DynamicDeque, without removing it.
+ * \param[in] sdeque Pointer to a DynamicDeque.
+ * \retval void*
+ * \arg If the deque isn't empty, returns a pointer to its last element.
+ * \arg Otherwise, returns NULL.
+ */
+void* DyndeqPeekBack (struct DynamicDeque* sdeque)
+{
+    return (sdeque->Count) ? DyndeqGetElement(sdeque, sdeque->Count - 1) : NULL;
+}
+
+/** \brief Returns a pointer to the first element of a DynamicDeque, without removing it.
+ * \param[in] sdeque Pointer to a DynamicDeque.
+ * \retval void*
+ * \arg If the deque isn't empty, returns a pointer to its first element.
+ * \arg Otherwise, returns NULL.
+ */
+void* DyndeqPeekFront (struct DynamicDeque* sdeque)
+{
+    return (sdeque->Count) ? DyndeqGetElement(sdeque, 0) : NULL;
+}
+
+/** \brief Returns a pointer to the element at the specified index of a DynamicDeque.
+ * \remark The pointer is invalidated when the deque grows.
+ * \param[in] sdeque Pointer to a DynamicDeque.
+ * \param[in] index Index of the element, counting from the first element of the deque.
+ * \retval void*
+ * \arg If successful, returns a pointer to the element.
+ * \arg Otherwise, returns NULL.
+ */
+void* DyndeqGetElement (struct DynamicDeque* sdeque, size_t index)
+{
+    if (index >= sdeque->Count)
+    {
+        #ifdef _WIN32
+            __mingw_fprintf(stderr, "Error: index %zu is out of bounds.\n", index);
+        #else
+            fprintf(stderr, "Error: index %zu is out of bounds.\n", index);
+        #endif // _WIN32
+        return NULL;
+    }
+
+    return sdeque->Array + (__DYNDEQ_SLOT(sdeque, index) * sdeque->TypeSize);
+}
+
+/** \brief Adds multiple elements to the end of a DynamicDeque.
+ * \details The elements are copied in at most two blocks, one on each side of the end of the buffer.
+ * Dynamic variables are deep copied.
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[in] source Pointer to an array with the elements to be added.
+ * \param[in] amount The amount of elements to be added.
+ * \retval size_t
+ * \arg If successful, returns the amount of elements contained in the deque.
+ * \arg Otherwise, returns zero.
+ */
+size_t DyndeqEnqueue (struct DynamicDeque* sdeque, void* source, size_t amount)
+{
+    if (sdeque->Type == 0)
+    {
+        fprintf(stderr, "Error: attempted to add an element to a null dynamic deque.\n");
+        return 0;
+    }
+    else if (amount > SIZE_MAX - sdeque->Count || !__Dyndeq_Grow(sdeque, sdeque->Count + amount))
+    {
+        fprintf(stderr, "Error: failed to add the elements to the dynamic deque.\n");
+        return 0;
+    }
+
+    sdeque->Count += amount;
+    __Dyndeq_CopyIn(sdeque, sdeque->Count - amount, source, amount);
+
+    return sdeque->Count;
+}
+
+/** \brief Removes multiple elements from the beginning of a DynamicDeque.
+ * \details The elements are copied in at most two blocks, one on each side of the end of the buffer.
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[out] target Pointer to an array that will receive the removed elements, in order. Dynamic variables
+ * are handed over, so the caller must clear them. If NULL, the elements are simply discarded.
+ * \param[in] amount The amount of elements to be removed. It's truncated to the amount of elements in the deque.
+ * \retval size_t
+ * \arg Returns the amount of elements removed.
+ */
+size_t DyndeqDequeue (struct DynamicDeque* sdeque, void* target, size_t amount)
+{
+    if (amount > sdeque->Count)
+        amount = sdeque->Count;
+
+    if (amount == 0)
+        return 0;
+
+    if (target)
+        __Dyndeq_CopyOut(sdeque, 0, target, amount);
+    else
+        __Dyndeq_Release(sdeque, 0, amount);
+
+    sdeque->Head = __DYNDEQ_SLOT(sdeque, amount);
+    sdeque->Count -= amount;
+
+    return amount;
+}
+
+/** \brief Ensures a DynamicDeque can store the specified amount of extra elements without reallocating.
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[in] extra The amount of elements that are going to be added.
+ * \retval size_t
+ * \arg If successful, returns the capacity of the deque.
+ * \arg Otherwise, returns zero.
+ */
+size_t DyndeqReserve (struct DynamicDeque* sdeque, size_t extra)
+{
+    if (sdeque->Type == 0 || extra > SIZE_MAX - sdeque->Count || !__Dyndeq_Grow(sdeque, sdeque->Count + extra))
+    {
+        fprintf(stderr, "Error: failed to reserve memory for the dynamic deque.\n");
+        return 0;
+    }
+
+    return sdeque->Capacity;
+}
+
+/** \brief Copies the elements of a DynamicDeque to a new DynamicArray, from first to last.
+ * \details Dynamic variables are deep copied.
+ * \param[in] sdeque Pointer to a DynamicDeque.
+ * \retval struct DynamicArray
+ * \arg If successful, returns a DynamicArray with the elements of the deque.
+ * \arg Otherwise, returns a DynamicArray with a null array.
+ */
+struct DynamicArray DyndeqToDynarr (struct DynamicDeque* sdeque)
+{
+    struct DynamicArray sarray = NewDynamicArray(sdeque->Count, sdeque->Type);
+    size_t first = (sdeque->Count < sdeque->Capacity - sdeque->Head) ? sdeque->Count : sdeque->Capacity - sdeque->Head;
+
+    if (!sarray.Array || sdeque->Count == 0)
+        return sarray;
+
+    // The elements wrap around the end of the buffer
+    DynarrInsertArray(sdeque->Array + (sdeque->Head * sdeque->TypeSize), &sarray, first, 0, sdeque->Type);
+    DynarrInsertArray(sdeque->Array, &sarray, sdeque->Count - first, first, sdeque->Type);
+
+    return sarray;
+}
+
+/** \brief Deallocates the memory of a DynamicDeque and resets all its properties.
+ *
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \return \c void
+ */
+void DyndeqClear (struct DynamicDeque* sdeque)
+{
+    // If the elements own any resources, release them first
+    if (sdeque->Array)
+        __Dyndeq_Release(sdeque, 0, sdeque->Count);
+
+    free(sdeque->Array);
+
+    // Reset everything
+    sdeque->Array = NULL;
+    sdeque->Capacity = 0;
+    sdeque->Count = 0;
+    sdeque->Head = 0;
+    sdeque->TypeSize = 0;
+    sdeque->Type = 0;
+}
+
+
+/* Support Functions */
+
+
+/** \brief Returns the size of the data types that can be stored in a DynamicDeque.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] DType The data type.
+ * \retval size_t
+ * \arg Returns the size of the type, in bytes, or zero if the type is not supported.
+ */
+static size_t __Dyndeq_SizeOf (enum DataType DType)
+{
+    switch (DType)
+    {
+        case Var:   return sizeof(struct DynamicVariable);
+        case Ptr:   return sizeof(void*);
+        default:    return __Dyn_SizeOf(DType);
+    }
+}
+
+/** \brief Ensures the buffer of a DynamicDeque can store the specified amount of elements.
+ * \details The capacity is doubled until it's big enough. The elements are moved to the beginning of the
+ * new buffer, so they no longer wrap around its end.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[in] required The amount of elements the deque must be able to store.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero and the deque is left untouched.
+ */
+static int __Dyndeq_Grow (struct DynamicDeque* sdeque, size_t required)
+{
+    size_t capacity = (sdeque->Capacity) ? sdeque->Capacity : 1;
+    void* buffer;
+
+    if (required <= sdeque->Capacity)
+        return 1;
+
+    while (capacity < required)
+    {
+        if (capacity > SIZE_MAX / 2 / sdeque->TypeSize)
+            return 0;
+
+        capacity *= 2;
+    }
+
+    if (!(buffer = calloc(capacity, sdeque->TypeSize)))
+        return 0;
+
+    if (sdeque->Array)
+    {
+        __Dyndeq_CopyOut(sdeque, 0, buffer, sdeque->Count);
+        free(sdeque->Array);
+    }
+
+    sdeque->Array = buffer;
+    sdeque->Capacity = capacity;
+    sdeque->Head = 0;
+
+    return 1;
+}
+
+/** \brief Copies elements into consecutive slots of a DynamicDeque, deep copying dynamic variables.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[in] index Index of the first slot, counting from the first element of the deque.
+ * \param[in] source Pointer to the elements.
+ * \param[in] amount The amount of elements.
+ * \return \c void
+ */
+static void __Dyndeq_CopyIn (struct DynamicDeque* sdeque, size_t index, const void* source, size_t amount)
+{
+    size_t slot = __DYNDEQ_SLOT(sdeque, index);
+    size_t first = (amount < sdeque->Capacity - slot) ? amount : sdeque->Capacity - slot;
+
+    if (sdeque->Type == Var)
+    {
+        for (size_t counter = 0; counter < amount; counter++)
+        {
+            struct DynamicVariable copy = DynvarCopy((struct DynamicVariable*)source + counter);
+            memcpy(sdeque->Array + (__DYNDEQ_SLOT(sdeque, index + counter) * sdeque->TypeSize), &copy, sizeof(copy));
+        }
+
+        return;
+    }
+
+    memcpy(sdeque->Array + (slot * sdeque->TypeSize), source, first * sdeque->TypeSize);
+    memcpy(sdeque->Array, source + (first * sdeque->TypeSize), (amount - first) * sdeque->TypeSize);
+}
+
+/** \brief Copies the elements in consecutive slots of a DynamicDeque to an array, as they are.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] sdeque Pointer to a DynamicDeque.
+ * \param[in] index Index of the first slot, counting from the first element of the deque.
+ * \param[out] target Pointer to the array that receives the elements.
+ * \param[in] amount The amount of elements.
+ * \return \c void
+ */
+static void __Dyndeq_CopyOut (struct DynamicDeque* sdeque, size_t index, void* target, size_t amount)
+{
+    size_t slot = __DYNDEQ_SLOT(sdeque, index);
+    size_t first = (amount < sdeque->Capacity - slot) ? amount : sdeque->Capacity - slot;
+
+    memcpy(target, sdeque->Array + (slot * sdeque->TypeSize), first * sdeque->TypeSize);
+    memcpy(target + (first * sdeque->TypeSize), sdeque->Array, (amount - first) * sdeque->TypeSize);
+}
+
+/** \brief Releases the resources owned by elements in consecutive slots of a DynamicDeque.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[out] sdeque Pointer to a DynamicDeque.
+ * \param[in] index Index of the first slot, counting from the first element of the deque.
+ * \param[in] amount The amount of elements.
+ * \return \c void
+ */
+static void __Dyndeq_Release (struct DynamicDeque* sdeque, size_t index, size_t amount)
+{
+    if (sdeque->Type != Var)
+        return;
+
+    for (size_t counter = 0; counter < amount; counter++)
+        DynvarClear(sdeque->Array + (__DYNDEQ_SLOT(sdeque, index + counter) * sdeque->TypeSize));
+}
@@ -1,13 +1,98 @@
 #include "../DynHeaders/dynlst.h"
+#include "../DynHeaders/dynsize.h"
+
+
+/* Private Types */
+
+
+/** \brief Represents a block of list elements allocated at once by a DynamicList.
+ * \remark The slabs of a list are chained from the most recent to the oldest.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynlstSlab
+{
+    struct __DynlstSlab* Next;      /**< Pointer to the slab allocated before this one. */
+    unsigned int Capacity;          /**< The amount of list elements in this slab. */
+    unsigned int Used;              /**< The amount of list elements handed out from this slab. */
+    struct __DynlstElem Elems[];    /**< The list elements. */
+};
+
+/** \brief The maximum height of the towers of the index of a DynamicList.
+ * \remark Each level holds a quarter of the towers of the level below, so 16 levels are enough for any list.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNLST_INDEX_LEVELS 16
+
+/** \brief Represents one level of a tower of the index of a DynamicList.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynlstLevel
+{
+    struct __DynlstTower* Next;     /**< Pointer to the next tower that reaches this level, or NULL. */
+    unsigned int Span;              /**< The difference between the index of the next tower and the index of this one. It counts up to the end of the list if there's no next tower. */
+};
+
+/** \brief Represents a tower of the index of a DynamicList. Towers are indexable skip list nodes
+ * that point to list elements.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynlstTower
+{
+    struct __DynlstElem* Element;   /**< Pointer to the list element this tower points to. */
+    struct __DynlstLevel Levels[];  /**< The levels of the tower, from the bottom up. */
+};
+
+/** \brief Represents the index of a DynamicList. See DynlstIndexBuild().
+ * \remark The head stands before the first list element, at index -1, and reaches every level.
+ * \warning <u>This is a private struct and is not meant to be directly accessed!</u>
+ */
+struct __DynlstIndex
+{
+    unsigned int Seed;              /**< The state of the generator of tower heights. */
+    struct __DynlstLevel Head[__DYNLST_INDEX_LEVELS];   /**< The levels of the head of the index. */
+};
+
+/** \brief The amount of list elements in the first slab of a DynamicList.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNLST_FIRST_SLAB 16
+
+/** \brief Checks whether a list element was taken from the slabs of its list.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNLST_POOLED(element) \
+    ((((element)->Type == Var) ? sizeof(Dynvar) : (element)->DataSize) <= DYNLST_INLINE_SIZE)
 
 
 /* Private Functions */
 
 
-static struct __DynlstElem* __Dynlst_NewElem (void*, enum DataType);
+static struct __DynlstElem* __Dynlst_NewElem (struct DynlstHeader*, void*, enum DataType);
+static struct __DynlstElem* __Dynlst_AllocElem (struct DynlstHeader*);
 static struct __DynlstElem* __Dynlst_GetElem (struct DynlstHeader*, int);
-static void __Dynlst_RemoveFirst (struct DynlstHeader*);
-static void __Dynlst_ClearElem (struct __DynlstElem*);
+static void __Dynlst_Link (struct DynlstHeader*, struct __DynlstElem*, struct __DynlstElem*, int);
+static void __Dynlst_Unlink (struct DynlstHeader*, struct __DynlstElem*, int);
+static struct __DynlstTower* __Dynlst_NewTower (struct __DynlstIndex*, struct __DynlstElem*, unsigned int*);
+static void __Dynlst_IndexPath (struct __DynlstIndex*, int, struct __DynlstLevel**, int*);
+static void __Dynlst_IndexInsert (struct __DynlstIndex*, struct __DynlstElem*, int);
+static void __Dynlst_IndexRemove (struct __DynlstIndex*, int);
+static void __Dynlst_IndexRelink (struct DynlstHeader*);
+static void __Dynlst_Sort (struct DynlstHeader*, int (*)(const struct __DynlstElem*, const struct __DynlstElem*), int);
+static int __Dynlst_CompareElem (const struct __DynlstElem*, const struct __DynlstElem*);
+static int __Dynlst_CompareByType (const void*, const void*, enum DataType, size_t);
+static void __Dynlst_ClearElem (struct DynlstHeader*, struct __DynlstElem*);
+static unsigned short __Dynulst_SizeOf (enum DataType);
+static struct __DynulstNode* __Dynulst_NewNode (struct DynamicUnrolledList*, struct __DynulstNode*);
+static void __Dynulst_FreeNode (struct DynamicUnrolledList*, struct __DynulstNode*);
+static struct __DynulstNode* __Dynulst_Locate (struct DynamicUnrolledList*, unsigned int, unsigned int*);
+static void __Dynulst_CopyIn (struct DynamicUnrolledList*, void*, void*);
+static void __Dynulst_Insert (struct DynamicUnrolledList*, struct __DynulstNode*, unsigned int, void*);
+static void __Dynulst_Erase (struct DynamicUnrolledList*, struct __DynulstNode*, unsigned int);
+
+/** \brief Returns a pointer to an element stored in a node of a DynamicUnrolledList.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNULST_ELEM(list, node, offset) ((void*)(node)->Data + ((size_t)(offset) * (list)->TypeSize))
 
 
 /* Public Functions */
@@ -57,30 +142,17 @@ inline void DynlstDequeue (struct DynlstHeader* header)
  */
 void DynlstRemove (struct DynlstHeader* header, int index)
 {
-    if (index >= (int)header->Count)
-    {
-        DynlstPop(header);
-        return;
-    }
-    else if (index <= 0)
-    {
-        __Dynlst_RemoveFirst(header);
+    // Check if the list is empty
+    if (!header->First)
         return;
-    }
-
-    struct __DynlstElem* toNuke = __Dynlst_GetElem(header, index);
 
-    // Link forward with previous
-    toNuke->Next->Prev = toNuke->Prev;
-    toNuke->Prev->Next = toNuke->Next;
-
-    // Update header
-    header->Count--;
-    header->Size -= toNuke->DataSize;
-    header->TotalSize = header->TotalSize - toNuke->DataSize - sizeof(__DynlstElem);
+    if (index >= (int)header->Count)
+        index = header->Count - 1;
+    else if (index < 0)
+        index = 0;
 
     // Nuke the specified element
-    __Dynlst_ClearElem(toNuke);
+    __Dynlst_Unlink(header, __Dynlst_GetElem(header, index), index);
 }
 
 /** \brief Adds an element to a linked list at the specified index.
@@ -103,19 +175,14 @@ void DynlstAdd (struct DynlstHeader* header, void* data, int index, enum DataTyp
         return;
     }
 
-    struct __DynlstElem* newElem = __Dynlst_NewElem(data, DType);   // Create new element
-    struct __DynlstElem* atIndex = __Dynlst_GetElem(header, index); // Fetch element at index
+    struct __DynlstElem* newElem = __Dynlst_NewElem(header, data, DType);   // Create new element
 
-    newElem->Next = atIndex;        // Link new element to forward
-    newElem->Prev = atIndex->Prev;  // Link new element to previous
-    newElem->Prev->Next = newElem;  // Link previous to new element
-    atIndex->Prev = newElem;        // Link forward to new element
-
-    // Update header
-    header->Count++;
-    header->Size += newElem->DataSize;
-    header->TotalSize += newElem->DataSize + sizeof(__DynlstElem);
+    // Exit if allocation for the new list element has failed
+    if (!newElem)
+        return;
 
+    // Link the new element before the element at index
+    __Dynlst_Link(header, newElem, __Dynlst_GetElem(header, index), index);
 }
 
 /** \brief Overwrites a list element with the provided data at the specified index.
@@ -134,60 +201,17 @@ void DynlstSet (struct DynlstHeader* header, void* data, int index, enum DataTyp
         return;
     }
 
-    struct __DynlstElem* toNuke = __Dynlst_GetElem(header, index);
-    struct __DynlstElem* newElem = __Dynlst_NewElem(data, DType);
-
-    // Safely link newElem to the list
-    if (index == 0)
-    {
-        if (header->Count > 1)
-        {
-            // If element is not the only one in the list
-            // Link newElem to the next element
-            newElem->Next = toNuke->Next;
-
-            // Link next element to newElem
-            toNuke->Next->Prev = newElem;
-        }
-        else
-        {
-            // If element is the only one in the list
-            header->Last = newElem;
-        }
-
-        // Update header
-        header->First = newElem;
-    }
-    else if (index == (int)header->Count - 1)
-    {
-        // If element is the last in the list
-        // Link newElem to the second to last element
-        newElem->Prev = toNuke->Prev;
-
-        // Link second to last to newElem
-        toNuke->Prev->Next = newElem;
-
-        // Update header
-        header->Last = newElem;
-    }
-    else
-    {
-        // If element is in the middle of the list
-        // Link list to newElem
-        toNuke->Prev->Next = newElem;
-        toNuke->Next->Prev = newElem;
+    struct __DynlstElem* newElem = __Dynlst_NewElem(header, data, DType);
 
-        // Link newElem to list
-        newElem->Next = toNuke->Next;
-        newElem->Prev = toNuke->Prev;
-    }
+    // Exit if allocation for the new list element has failed
+    if (!newElem)
+        return;
 
-    // Update the header
-    header->Size = (header->Size - toNuke->DataSize) + newElem->DataSize;
-    header->TotalSize = (header->TotalSize - toNuke->DataSize) + newElem->DataSize;
+    struct __DynlstElem* toNuke = __Dynlst_GetElem(header, index);
 
-    // Nuke the old element
-    __Dynlst_ClearElem(toNuke);
+    // Link newElem in place of the old element, then nuke the old element
+    __Dynlst_Link(header, newElem, toNuke, index);
+    __Dynlst_Unlink(header, toNuke, index + 1);
 }
 
 /** \brief Returns a pointer to the list element at the specified index.
@@ -211,23 +235,39 @@ struct __DynlstElem* DynlstGet (struct DynlstHeader* header, int index)
 }
 
 /** \brief Deallocates the memory used by the linked list and resets all its properties.
- *
+ * \remark The index of the list, if any, is removed as well.
  * \param[in] header The header of the linked list.
  * \return \c void
  */
 void DynlstClear (struct DynlstHeader* header)
 {
-    struct __DynlstElem* element = header->Last->Prev;
+    struct __DynlstElem* element = header->First;
+    struct __DynlstElem* next;
+    struct __DynlstSlab* slab = header->Slabs;
+
+    DynlstIndexClear(header);
 
-    // Clear the list
+    // Release the data stored outside of the slabs
     while (element)
     {
-        __Dynlst_ClearElem(element->Next);
-        element = element->Prev;
+        next = element->Next;
+
+        if (element->Type == Var)
+            DynvarClear(element->Data);
+
+        if (!__DYNLST_POOLED(element))
+            free(element);
+
+        element = next;
     }
 
-    // Clear the remaining first element of the list
-    __Dynlst_ClearElem(header->First);
+    // Release the pooled elements all at once
+    while (slab)
+    {
+        header->Slabs = slab->Next;
+        free(slab);
+        slab = header->Slabs;
+    }
 
     // Reset the header
     header->First = NULL;
@@ -235,6 +275,7 @@ void DynlstClear (struct DynlstHeader* header)
     header->Count = 0;
     header->Size = 0;
     header->TotalSize = sizeof(Dynlst);
+    header->Spare = NULL;
 }
 
 /** \brief Removes the last list element of a linked list.
@@ -245,31 +286,11 @@ void DynlstClear (struct DynlstHeader* header)
 void DynlstPop (struct DynlstHeader* header)
 {
     // Check if the list is empty
-    if (!header->First)
+    if (!header->Last)
         return;
 
-    // Temporarily store address of the last element
-    struct __DynlstElem* toNuke = header->Last;
-
-    // If element is not the only one in the list
-    if (header->Count > 1)
-    {
-        header->Last = toNuke->Prev;    // Use it to get to the second to last element. Set header->Last to it
-        header->Last->Next = NULL;      // Set its Next pointer to NULL
-    }
-    else
-    {
-        header->First = NULL;           // If element is the only one in the list,
-        header->Last = NULL;            // reset the header pointers
-    }
-
-    // Update header
-    header->Count--;
-    header->Size -= toNuke->DataSize;
-    header->TotalSize -= toNuke->DataSize + sizeof(__DynlstElem);
-
-    // Deallocate the element
-    __Dynlst_ClearElem(toNuke);
+    // Deallocate the last element
+    __Dynlst_Unlink(header, header->Last, header->Count - 1);
 }
 
 /** \brief Adds a list element to the end of a linked list.
@@ -281,28 +302,14 @@ void DynlstPop (struct DynlstHeader* header)
  */
 void DynlstPush (struct DynlstHeader* header, void* data, enum DataType DType)
 {
-    struct __DynlstElem* newElem = __Dynlst_NewElem(data, DType);
+    struct __DynlstElem* newElem = __Dynlst_NewElem(header, data, DType);
 
     // Exit if allocation for the new list element has failed
     if (!newElem)
         return;
 
-    // Update the list header
-    // If this is the first element in the list, link it to the header
-    if (header->Count == 0)
-    {
-        header->First = header->Last = newElem;
-    }
-    else
-    {
-        newElem->Prev = header->Last;       // Link oldElem to newElem
-        header->Last->Next = newElem;       // Link newElem to oldElem
-        header->Last = newElem;             // Link header->Last to newElem
-    }
-
-    header->Count++;                                                  // Update header count
-    header->Size += newElem->DataSize;                                // Update amount of bytes allocated for the data stored in the list
-    header->TotalSize += newElem->DataSize + sizeof(__DynlstElem);    // Update total amount of bytes in the list (data + objects)
+    // Link newElem after the last element
+    __Dynlst_Link(header, newElem, NULL, header->Count);
 }
 
 /** \brief Adds a list element to the beginning of a linked list.
@@ -314,28 +321,14 @@ void DynlstPush (struct DynlstHeader* header, void* data, enum DataType DType)
  */
 void DynlstEnqueue (struct DynlstHeader* header, void* data, enum DataType DType)
 {
-    struct __DynlstElem* newElem = __Dynlst_NewElem(data, DType);
+    struct __DynlstElem* newElem = __Dynlst_NewElem(header, data, DType);
 
     // Exit if allocation for the new list element has failed
     if (!newElem)
         return;
 
-    // Update the list header
-    // If this is the first element in the list, link it to the header
-    if (header->Count == 0)
-    {
-        header->First = header->Last = newElem;
-    }
-    else
-    {
-        header->First->Prev = newElem;      // Link oldElem to the newElem
-        newElem->Next = header->First;      // Link newElem to oldElem
-        header->First = newElem;            // Link header->First to newElem
-    }
-
-    header->Count++;                                                // Update header count
-    header->Size += newElem->DataSize;                              // Update amount of bytes allocated for the data stored in the list
-    header->TotalSize += newElem->DataSize + sizeof(__DynlstElem);    // Update total amount of bytes in the list (data + objects)
+    // Link newElem before the first element
+    __Dynlst_Link(header, newElem, header->First, 0);
 }
 
 /** \brief Prints all the data in a linked list and its stats.
@@ -551,230 +544,1478 @@ void DynlstPrintElem (struct DynlstHeader* header, int index, char* separator)
 }
 
 
-/* Support Functions */
-
-
-/** \brief Instantiates a new list element with the specified data.
- * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[in] data The data to be added.
- * \param[in] DType The type of data to be added.
- * \retval struct __DynlstElem*
- * \arg If successful, returns a pointer to the newly generated list element.
- * \arg Otherwise, returns NULL.
+/** \brief Builds an index over a linked list, so that accessing its elements by index position takes logarithmic time.
+ * \details The index is an indexable skip list whose nodes point to about a quarter of the list elements.
+ * Once built, it's kept up to date by every function that adds or removes list elements, and it's used by
+ * DynlstGet(), DynlstSet(), DynlstAdd(), DynlstRemove(), DynlstPrintElem() and DynlstCursorAt().
+ * It only pays off for lists that are often accessed at random positions.
+ * \param[in] header The header of the linked list.
+ * \retval int
+ * \arg If successful, returns non-zero.
+ * \arg Otherwise, returns zero and the list is left without an index.
  */
-static struct __DynlstElem* __Dynlst_NewElem (void* data, enum DataType DType)
+int DynlstIndexBuild (struct DynlstHeader* header)
 {
-    struct __DynlstElem* element = malloc(sizeof(__DynlstElem));
+    struct __DynlstLevel* last[__DYNLST_INDEX_LEVELS];
+    int lastRank[__DYNLST_INDEX_LEVELS];
+    struct __DynlstTower* tower;
+    unsigned int height;
+    int rank = 0;
 
-    if (!element)
+    // Check if the list already has an index
+    if (header->Index)
+        return 1;
+
+    header->Index = malloc(sizeof(struct __DynlstIndex));
+
+    if (!header->Index)
     {
-        fprintf(stderr, "Error: failed to allocate memory for a new list element.\n");
-        return NULL;
+        fprintf(stderr, "Error: failed to allocate memory for the index of the list.\n");
+        return 0;
     }
 
-    switch (DType)
-    {
-        case Char:
-            element->Data = malloc(sizeof(signed char));
-            *(signed char*)element->Data = *(signed char*)data;
-            element->Type = Char;
-            element->TypeSize = sizeof(signed char);
-            element->DataSize = sizeof(signed char);
-            break;
+    header->Index->Seed = 0x9E3779B9u;
 
-        case Short:
-            element->Data = malloc(sizeof(short));
-            *(short*)element->Data = *(short*)data;
-            element->Type = Short;
-            element->TypeSize = sizeof(short);
-            element->DataSize = sizeof(short);
-            break;
+    for (int level = 0; level < __DYNLST_INDEX_LEVELS; level++)
+    {
+        last[level] = &header->Index->Head[level];
+        lastRank[level] = -1;
+    }
 
-        case Int:
-            element->Data = malloc(sizeof(int));
-            *(int*)element->Data = *(int*)data;
-            element->Type = Int;
-            element->TypeSize = sizeof(int);
-            element->DataSize = sizeof(int);
-            break;
+    // Link the towers to the last tower that reached each of their levels
+    for (struct __DynlstElem* element = header->First; element; element = element->Next, rank++)
+    {
+        if (!(tower = __Dynlst_NewTower(header->Index, element, &height)))
+            continue;
 
-        case Long:
-            element->Data = malloc(sizeof(long));
-            *(long*)element->Data = *(long*)data;
-            element->Type = Long;
-            element->TypeSize = sizeof(long);
-            element->DataSize = sizeof(long);
-            break;
+        for (unsigned int level = 0; level < height; level++)
+        {
+            last[level]->Next = tower;
+            last[level]->Span = rank - lastRank[level];
+            last[level] = &tower->Levels[level];
+            lastRank[level] = rank;
+        }
+    }
 
-        case LLong:
-            element->Data = malloc(sizeof(long long));
-            *(long long*)element->Data = *(long long*)data;
-            element->Type = LLong;
-            element->TypeSize = sizeof(long long);
-            element->DataSize = sizeof(long long);
-            break;
+    // Terminate every level at the end of the list
+    for (int level = 0; level < __DYNLST_INDEX_LEVELS; level++)
+    {
+        last[level]->Next = NULL;
+        last[level]->Span = header->Count - lastRank[level];
+    }
 
-        case UChar:
-            element->Data = malloc(sizeof(unsigned char));
-            *(unsigned char*)element->Data = *(unsigned char*)data;
-            element->Type = UChar;
-            element->TypeSize = sizeof(unsigned char);
-            element->DataSize = sizeof(unsigned char);
-            break;
+    return 1;
+}
 
-        case UShort:
-            element->Data = malloc(sizeof(unsigned short));
-            *(unsigned short*)element->Data = *(unsigned short*)data;
-            element->Type = UShort;
-            element->TypeSize = sizeof(unsigned short);
-            element->DataSize = sizeof(unsigned short);
-            break;
+/** \brief Removes the index of a linked list. The list elements are left untouched.
+ * \remark Afterwards, accessing the list by index position takes linear time again.
+ * \param[in] header The header of the linked list.
+ * \return \c void
+ */
+void DynlstIndexClear (struct DynlstHeader* header)
+{
+    struct __DynlstTower* tower;
+    struct __DynlstTower* next;
 
-        case UInt:
-            element->Data = malloc(sizeof(unsigned int));
-            *(unsigned int*)element->Data = *(unsigned int*)data;
-            element->Type = UInt;
-            element->TypeSize = sizeof(unsigned int);
-            element->DataSize = sizeof(unsigned int);
-            break;
+    if (!header->Index)
+        return;
 
-        case ULong:
-            element->Data = malloc(sizeof(unsigned long));
-            *(unsigned long*)element->Data = *(unsigned long*)data;
-            element->Type = ULong;
-            element->TypeSize = sizeof(unsigned long);
-            element->DataSize = sizeof(unsigned long);
-            break;
+    // Every tower reaches the bottom level
+    for (tower = header->Index->Head[0].Next; tower; tower = next)
+    {
+        next = tower->Levels[0].Next;
+        free(tower);
+    }
 
-        case ULLong:
-            element->Data = malloc(sizeof(unsigned long long));
-            *(unsigned long long*)element->Data = *(unsigned long long*)data;
-            element->Type = ULLong;
-            element->TypeSize = sizeof(unsigned long long);
-            element->DataSize = sizeof(unsigned long long);
-            break;
+    free(header->Index);
+    header->Index = NULL;
+}
 
-        case Float:
-            element->Data = malloc(sizeof(float));
-            *(float*)element->Data = *(float*)data;
-            element->Type = Float;
-            element->TypeSize = sizeof(float);
-            element->DataSize = sizeof(float);
-            break;
+/** \brief Sorts a linked list in ascending order.
+ * \details The list elements are relinked by a bottom-up merge sort, so no memory is allocated and elements
+ * that compare equal keep their relative order. Elements that store data of different types are sorted by
+ * type. Otherwise, they are sorted by value. Strings are compared with \c strcmp() and dynamic variables are
+ * compared by the data stored in them.
+ * \param[in] header The header of the linked list.
+ * \return \c void
+ */
+void DynlstSort (struct DynlstHeader* header)
+{
+    __Dynlst_Sort(header, __Dynlst_CompareElem, 0);
+}
 
-        case Double:
-            element->Data = malloc(sizeof(double));
-            *(double*)element->Data = *(double*)data;
-            element->Type = Double;
-            element->TypeSize = sizeof(double);
-            element->DataSize = sizeof(double);
-            break;
+/** \brief Sorts a linked list in descending order.
+ * \details It works the same as DynlstSort(), in reverse. Elements that compare equal keep their relative order.
+ * \param[in] header The header of the linked list.
+ * \return \c void
+ */
+void DynlstSortDesc (struct DynlstHeader* header)
+{
+    __Dynlst_Sort(header, __Dynlst_CompareElem, 1);
+}
 
-        case LDouble:
-            element->Data = malloc(sizeof(long double));
-            *(long double*)element->Data = *(long double*)data;
-            element->Type = LDouble;
-            element->TypeSize = sizeof(long double);
-            element->DataSize = sizeof(long double);
-            break;
+/** \brief Sorts a linked list in the order specified by the <i>compar</i> function.
+ * \details The list elements are relinked by a bottom-up merge sort, so no memory is allocated and elements
+ * that compare equal keep their relative order.
+ * \param[in] header The header of the linked list.
+ * \param[in] compar
+ * \parblock
+ * Pointer to a function that compares two list elements and returns an \c int that is:
+ * <br> <u>Less than zero</u>, if first element is going to be placed before the second element.
+ * <br> <u>Zero</u>, if both elements are to remain in the order they are in.
+ * <br> <u>Greater than zero</u>, if first element is going to be placed after the second element.
+ * \endparblock
+ * \return \c void
+ */
+void DynlstSortCustom (struct DynlstHeader* header, int (*compar)(const struct __DynlstElem*, const struct __DynlstElem*))
+{
+    __Dynlst_Sort(header, compar, 0);
+}
 
-        case String:
-            element->Type = String;
-            element->TypeSize = sizeof(char);
-            element->DataSize = strlen(data) + 1;
-            element->Data = malloc(element->DataSize);
-            strcpy(element->Data, data);
-            break;
+/** \brief Instantiates a cursor at the specified index of a linked list.
+ * \remark If the specified index is out of range, the cursor is placed either at the first element
+ * or past the end of the list.
+ * \param[in] header The header of the linked list.
+ * \param[in] index The index of the list element the cursor should point to.
+ * \retval struct DynlstCursor
+ * \arg Returns a cursor at the specified index.
+ */
+struct DynlstCursor DynlstCursorAt (struct DynlstHeader* header, int index)
+{
+    struct DynlstCursor cursor = { .List = header, .Element = NULL, .Index = header->Count };
 
-        case Var:
-            element->Data = malloc(sizeof(Dynvar));
-            *(Dynvar*)element->Data = DynvarCopy(data);
-            element->Type = Var;
-            element->TypeSize = sizeof(Dynvar);
-            element->DataSize = sizeof(Dynvar) + ((Dynvar*)element->Data)->Size;
-            break;
+    if (index < 0)
+        index = 0;
 
-        default:
-            fprintf(stderr, "Error: this data type is not supported.\n");
-            return NULL;
+    if (index < (int)header->Count)
+    {
+        cursor.Element = __Dynlst_GetElem(header, index);
+        cursor.Index = index;
     }
 
-    // These pointers should be properly initialized after this call is returned
-    element->Next = NULL;
-    element->Prev = NULL;
+    return cursor;
+}
 
-    return element;
+/** \brief Moves a cursor to the next element of its linked list.
+ *
+ * \param[in] cursor Pointer to the cursor.
+ * \retval int
+ * \arg Returns non-zero if the cursor points to a list element after moving.
+ * \arg Returns zero if it's past the end of the list.
+ */
+int DynlstCursorNext (struct DynlstCursor* cursor)
+{
+    // Check if the cursor is already past the end
+    if (!cursor->Element)
+        return 0;
+
+    cursor->Element = cursor->Element->Next;
+    cursor->Index++;
+
+    return cursor->Element != NULL;
 }
 
-/** \brief Safely removes the first element of a linked list.
- * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[in] header The header of the linked list.
+/** \brief Moves a cursor to the previous element of its linked list.
+ * \remark A cursor past the end of the list is moved to its last element.
+ * \param[in] cursor Pointer to the cursor.
+ * \retval int
+ * \arg Returns non-zero if the cursor was moved.
+ * \arg Returns zero if it was already at the first element of the list, or if the list is empty.
+ */
+int DynlstCursorPrev (struct DynlstCursor* cursor)
+{
+    struct __DynlstElem* previous = (cursor->Element) ? cursor->Element->Prev : cursor->List->Last;
+
+    if (!previous)
+        return 0;
+
+    cursor->Element = previous;
+    cursor->Index--;
+
+    return 1;
+}
+
+/** \brief Returns a pointer to the list element at a cursor.
+ * \remark It's recommended that the members of the list element be
+ * accessed for reading purposes only.
+ * \param[in] cursor Pointer to the cursor.
+ * \retval struct __DynlstElem*
+ * \arg Returns a pointer to the list element, or NULL if the cursor is past the end of the list.
+ */
+struct __DynlstElem* DynlstCursorGet (struct DynlstCursor* cursor)
+{
+    return cursor->Element;
+}
+
+/** \brief Overwrites the list element at a cursor with the provided data.
+ *
+ * \param[in] cursor Pointer to the cursor.
+ * \param[in] data The data to be written to the list element.
+ * \param[in] DType The type of data that's being written to the list element.
  * \return \c void
  */
-static void __Dynlst_RemoveFirst (struct DynlstHeader* header)
+void DynlstCursorSet (struct DynlstCursor* cursor, void* data, enum DataType DType)
 {
-    // If element is the only one in the list
-    if (header->Count <= 1)
+    if (!cursor->Element)
     {
-        DynlstPop(header);
+        fprintf(stderr, "Error: the cursor is past the end of the list.\n");
         return;
     }
 
-    struct __DynlstElem* toNuke = header->First;
+    struct __DynlstElem* newElem = __Dynlst_NewElem(cursor->List, data, DType);
 
-    header->First = toNuke->Next;
-    toNuke->Next->Prev = NULL;
+    // Exit if allocation for the new list element has failed
+    if (!newElem)
+        return;
 
-    // Update header
-    header->Count--;
-    header->Size -= toNuke->DataSize;
-    header->TotalSize = header->TotalSize - toNuke->DataSize - sizeof(__DynlstElem);
+    // Link newElem in place of the old element, then nuke the old element
+    __Dynlst_Link(cursor->List, newElem, cursor->Element, cursor->Index);
+    __Dynlst_Unlink(cursor->List, cursor->Element, cursor->Index + 1);
 
-    // Nuke the element
-    __Dynlst_ClearElem(toNuke);
+    cursor->Element = newElem;
 }
 
-/** \brief Deallocates a list element and the data stored in it.
- * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[in] element The header of the linked list.
+/** \brief Adds an element to a linked list before the element at a cursor.
+ * \remark The cursor keeps pointing to the same element. If it's past the end of the list,
+ * the element is pushed into the list.
+ * \param[in] cursor Pointer to the cursor.
+ * \param[in] data The data to be added.
+ * \param[in] DType The type of data to be added.
  * \return \c void
  */
-static void __Dynlst_ClearElem (struct __DynlstElem* element)
+void DynlstCursorInsertBefore (struct DynlstCursor* cursor, void* data, enum DataType DType)
 {
-    if (element->Type == Var)
-        DynvarClear(element->Data);
+    struct __DynlstElem* newElem = __Dynlst_NewElem(cursor->List, data, DType);
+
+    // Exit if allocation for the new list element has failed
+    if (!newElem)
+        return;
 
-    free(element->Data);
-    free(element);
+    __Dynlst_Link(cursor->List, newElem, cursor->Element, cursor->Index);
+    cursor->Index++;
 }
 
-/** \brief Returns a pointer to the list element at the specified index.
- * \warning <u>This is a private function and is not meant to be directly invoked!</u>
- * \param[in] header The header of the linked list.
- * \param[in] index The index to fetch the list element from.
- * \retval struct __DynlstElem*
- * \arg Returns a pointer to the list element.
+/** \brief Adds an element to a linked list after the element at a cursor.
+ * \remark The cursor keeps pointing to the same element.
+ * \param[in] cursor Pointer to the cursor.
+ * \param[in] data The data to be added.
+ * \param[in] DType The type of data to be added.
+ * \return \c void
  */
-static struct __DynlstElem* __Dynlst_GetElem (struct DynlstHeader* header, int index)
+void DynlstCursorInsertAfter (struct DynlstCursor* cursor, void* data, enum DataType DType)
 {
-    struct __DynlstElem* target;
-
-    if (index <= (int)header->Count / 2)
+    if (!cursor->Element)
     {
-        // Start from the beginning
-        target = header->First;
-
-        for (int counter = 0; counter != index; counter++)
-            target = target->Next;
+        fprintf(stderr, "Error: the cursor is past the end of the list.\n");
+        return;
     }
-    else
-    {
-        // Start from the end
-        target = header->Last;
 
-        for (int counter = header->Count - 1; counter != index; counter--)
-            target = target->Prev;
-    }
+    struct __DynlstElem* newElem = __Dynlst_NewElem(cursor->List, data, DType);
+
+    // Exit if allocation for the new list element has failed
+    if (!newElem)
+        return;
+
+    __Dynlst_Link(cursor->List, newElem, cursor->Element->Next, cursor->Index + 1);
+}
+
+/** \brief Removes the list element at a cursor.
+ * \remark The cursor is moved to the element that followed the removed one, so its index stays the same.
+ * \param[in] cursor Pointer to the cursor.
+ * \return \c void
+ */
+void DynlstCursorRemove (struct DynlstCursor* cursor)
+{
+    struct __DynlstElem* toNuke = cursor->Element;
+
+    if (!toNuke)
+    {
+        fprintf(stderr, "Error: the cursor is past the end of the list.\n");
+        return;
+    }
+
+    cursor->Element = toNuke->Next;
+    __Dynlst_Unlink(cursor->List, toNuke, cursor->Index);
+}
+
+/** \brief Instantiates a new, empty, DynamicUnrolledList.
+ *
+ * \param[in] DType The data type of the elements to be stored in the list.
+ * \retval struct DynamicUnrolledList
+ * \arg If successful, returns an empty unrolled list.
+ * \arg Otherwise, returns a list with a \c Type of zero, which can't store any elements.
+ */
+struct DynamicUnrolledList NewDynamicUnrolledList (enum DataType DType)
+{
+    struct DynamicUnrolledList list = { .First = NULL, .Last = NULL, .Count = 0, .Type = DType, .TypeSize = __Dynulst_SizeOf(DType) };
+
+    if (list.TypeSize == 0)
+    {
+        fprintf(stderr, "Error: unrecognized type. A null unrolled list was generated.\n");
+        list.Type = 0;
+        return list;
+    }
+
+    list.NodeCapacity = DYNLST_UNROLL_SIZE / list.TypeSize;
+
+    if (list.NodeCapacity < 4)
+        list.NodeCapacity = 4;
+
+    return list;
+}
+
+/** \brief Adds an element to an unrolled list at the specified index.
+ * \remark If the specified index is out of range, the function will either
+ * enqueue or push the element into the list.
+ * \param[in] list The unrolled list.
+ * \param[in] data Pointer to the element to be added. Dynamic variables are deep copied.
+ * \param[in] index The index to add the element to.
+ * \return \c void
+ */
+void DynulstAdd (struct DynamicUnrolledList* list, void* data, int index)
+{
+    unsigned int offset;
+
+    if (index >= (int)list->Count)
+    {
+        DynulstPush(list, data);
+        return;
+    }
+    else if (index <= 0)
+    {
+        DynulstEnqueue(list, data);
+        return;
+    }
+
+    struct __DynulstNode* node = __Dynulst_Locate(list, index, &offset);
+    __Dynulst_Insert(list, node, offset, data);
+}
+
+/** \brief Adds an element to the end of an unrolled list.
+ *
+ * \param[in] list The unrolled list.
+ * \param[in] data Pointer to the element to be added. Dynamic variables are deep copied.
+ * \return \c void
+ */
+void DynulstPush (struct DynamicUnrolledList* list, void* data)
+{
+    struct __DynulstNode* node = list->Last;
+
+    // Start a new node instead of splitting the last one, so pushed elements fill their nodes
+    if (!node || node->Count == list->NodeCapacity)
+    {
+        if (!(node = __Dynulst_NewNode(list, list->Last)))
+            return;
+    }
+
+    __Dynulst_Insert(list, node, node->Count, data);
+}
+
+/** \brief Removes the last element of an unrolled list.
+ *
+ * \param[in] list The unrolled list.
+ * \return \c void
+ */
+void DynulstPop (struct DynamicUnrolledList* list)
+{
+    // Check if the list is empty
+    if (!list->Last)
+        return;
+
+    __Dynulst_Erase(list, list->Last, list->Last->Count - 1);
+}
+
+/** \brief Adds an element to the beginning of an unrolled list.
+ *
+ * \param[in] list The unrolled list.
+ * \param[in] data Pointer to the element to be added. Dynamic variables are deep copied.
+ * \return \c void
+ */
+void DynulstEnqueue (struct DynamicUnrolledList* list, void* data)
+{
+    struct __DynulstNode* node = list->First;
+
+    // Start a new node instead of splitting the first one
+    if (!node || node->Count == list->NodeCapacity)
+    {
+        if (!(node = __Dynulst_NewNode(list, NULL)))
+            return;
+    }
+
+    __Dynulst_Insert(list, node, 0, data);
+}
+
+/** \brief Removes the element at the end of an unrolled list.
+ * \remark It works the same as DynulstPop().
+ * \param[in] list The unrolled list.
+ * \return \c void
+ */
+void DynulstDequeue (struct DynamicUnrolledList* list)
+{
+    DynulstPop(list);
+}
+
+/** \brief Removes the element at the specified index.
+ * \remark If the specified index is out of range, the function will either
+ * remove the first or the last element in the list.
+ * \param[in] list The unrolled list.
+ * \param[in] index The index to remove the element from.
+ * \return \c void
+ */
+void DynulstRemove (struct DynamicUnrolledList* list, int index)
+{
+    unsigned int offset;
+
+    // Check if the list is empty
+    if (list->Count == 0)
+        return;
+
+    if (index >= (int)list->Count)
+        index = list->Count - 1;
+    else if (index < 0)
+        index = 0;
+
+    struct __DynulstNode* node = __Dynulst_Locate(list, index, &offset);
+    __Dynulst_Erase(list, node, offset);
+}
+
+/** \brief Overwrites an element of an unrolled list with the provided data at the specified index.
+ *
+ * \param[in] list The unrolled list.
+ * \param[in] data Pointer to the data to be written to the element. Dynamic variables are deep copied.
+ * \param[in] index The index of the element to be changed.
+ * \return \c void
+ */
+void DynulstSet (struct DynamicUnrolledList* list, void* data, int index)
+{
+    unsigned int offset;
+
+    if (index < 0 || index >= (int)list->Count)
+    {
+        fprintf(stderr, "Error: index out of range.\n");
+        return;
+    }
+
+    struct __DynulstNode* node = __Dynulst_Locate(list, index, &offset);
+    void* element = __DYNULST_ELEM(list, node, offset);
+
+    if (list->Type == Var)
+        DynvarClear(element);
+
+    __Dynulst_CopyIn(list, element, data);
+}
+
+/** \brief Returns a pointer to the element at the specified index.
+ * \remark The pointer is invalidated when an element is added to or removed from the list.
+ * \param[in] list The unrolled list.
+ * \param[in] index The index to fetch the element from.
+ * \retval void*
+ * \arg If successful, returns a pointer to the element.
+ * \arg Otherwise, returns NULL.
+ */
+void* DynulstGet (struct DynamicUnrolledList* list, int index)
+{
+    unsigned int offset;
+
+    if (index < 0 || index >= (int)list->Count)
+    {
+        fprintf(stderr, "Error: index out of range.\n");
+        return NULL;
+    }
+
+    struct __DynulstNode* node = __Dynulst_Locate(list, index, &offset);
+
+    return __DYNULST_ELEM(list, node, offset);
+}
+
+/** \brief Searches for the specified element and returns its index position in the list, if it exists.
+ * \remark It does not work with dynamic variables and will always return -1 for them.
+ * \param[in] list The unrolled list.
+ * \param[in] data Pointer to the element to be searched for.
+ * \retval int
+ * \arg If successful, returns the index position of the specified element.
+ * \arg returns -1 if the element is not found in the list.
+ */
+int DynulstIndexOf (struct DynamicUnrolledList* list, void* data)
+{
+    int index = 0;
+
+    if (list->Type == Var)
+        return -1;
+
+    for (struct __DynulstNode* node = list->First; node; node = node->Next)
+    {
+        for (unsigned int counter = 0; counter < node->Count; counter++)
+        {
+            if (!memcmp(__DYNULST_ELEM(list, node, counter), data, list->TypeSize))
+                return index + counter;
+        }
+
+        index += node->Count;
+    }
+
+    return -1;
+}
+
+/** \brief Prints all the elements in an unrolled list.
+ *
+ * \param[in] list The unrolled list.
+ * \param[in] delimiter A string to be added between each element.
+ * \return \c void
+ */
+void DynulstPrint (struct DynamicUnrolledList* list, char* delimiter)
+{
+    for (struct __DynulstNode* node = list->First; node; node = node->Next)
+    {
+        for (unsigned int counter = 0; counter < node->Count; counter++)
+        {
+            void* element = __DYNULST_ELEM(list, node, counter);
+
+            switch (list->Type)
+            {
+                case Char:
+                    printf("%c%s", *(signed char*)element, delimiter);
+                    break;
+
+                case Short:
+                    printf("%d%s", *(short*)element, delimiter);
+                    break;
+
+                case Int:
+                    printf("%d%s", *(int*)element, delimiter);
+                    break;
+
+                case Long:
+                    printf("%ld%s", *(long*)element, delimiter);
+                    break;
+
+                case LLong:
+                    #ifdef _WIN32
+                        __mingw_printf("%lld%s", *(long long*)element, delimiter);
+                    #else
+                        printf("%lld%s", *(long long*)element, delimiter);
+                    #endif // _WIN32
+                    break;
+
+                case UChar:
+                    printf("%c%s", *(unsigned char*)element, delimiter);
+                    break;
+
+                case UShort:
+                    printf("%u%s", *(unsigned short*)element, delimiter);
+                    break;
+
+                case UInt:
+                    printf("%u%s", *(unsigned int*)element, delimiter);
+                    break;
+
+                case ULong:
+                    printf("%lu%s", *(unsigned long*)element, delimiter);
+                    break;
+
+                case ULLong:
+                    #ifdef _WIN32
+                        __mingw_printf("%llu%s", *(unsigned long long*)element, delimiter);
+                    #else
+                        printf("%llu%s", *(unsigned long long*)element, delimiter);
+                    #endif // _WIN32
+                    break;
+
+                case Float:
+                    printf("%.6g%s", *(float*)element, delimiter);
+                    break;
+
+                case Double:
+                    printf("%.15g%s", *(double*)element, delimiter);
+                    break;
+
+                case LDouble:
+                    #ifdef _WIN32
+                        __mingw_printf("%.19Lg%s", *(long double*)element, delimiter);
+                    #else
+                        printf("%.19Lg%s", *(long double*)element, delimiter);
+                    #endif // _WIN32
+                    break;
+
+                case Var:
+                    DynvarPrint(element, delimiter);
+                    break;
+
+                case Ptr:
+                    printf("%p%s", *(void**)element, delimiter);
+                    break;
+
+                default:
+                    fprintf(stderr, "Error: this data type is not supported.\n");
+                    return;
+            }
+        }
+    }
+}
+
+/** \brief Deallocates the memory used by an unrolled list and removes all its elements.
+ * \remark The list can still be used afterwards.
+ * \param[in] list The unrolled list.
+ * \return \c void
+ */
+void DynulstClear (struct DynamicUnrolledList* list)
+{
+    struct __DynulstNode* node = list->First;
+
+    while (node)
+    {
+        list->First = node->Next;
+
+        if (list->Type == Var)
+        {
+            for (unsigned int counter = 0; counter < node->Count; counter++)
+                DynvarClear(__DYNULST_ELEM(list, node, counter));
+        }
+
+        free(node);
+        node = list->First;
+    }
+
+    list->Last = NULL;
+    list->Count = 0;
+}
+
+
+/* Support Functions */
+
+
+/** \brief Instantiates a new list element with the specified data.
+ * \remark Data that fits in the element is stored in it, and the element is taken from the slabs
+ * of the list. Larger data is stored right after an element allocated on its own.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \param[in] data The data to be added.
+ * \param[in] DType The type of data to be added.
+ * \retval struct __DynlstElem*
+ * \arg If successful, returns a pointer to the newly generated list element.
+ * \arg Otherwise, returns NULL.
+ */
+static struct __DynlstElem* __Dynlst_NewElem (struct DynlstHeader* header, void* data, enum DataType DType)
+{
+    struct __DynlstElem* element;
+    Dynvar copy;
+    size_t typeSize;
+    size_t dataSize;
+
+    switch (DType)
+    {
+        case Char:
+        case UChar:
+            typeSize = dataSize = sizeof(char);
+            break;
+
+        case Short:
+        case UShort:
+            typeSize = dataSize = sizeof(short);
+            break;
+
+        case Int:
+        case UInt:
+            typeSize = dataSize = sizeof(int);
+            break;
+
+        case Long:
+        case ULong:
+            typeSize = dataSize = sizeof(long);
+            break;
+
+        case LLong:
+        case ULLong:
+            typeSize = dataSize = sizeof(long long);
+            break;
+
+        case Float:
+            typeSize = dataSize = sizeof(float);
+            break;
+
+        case Double:
+            typeSize = dataSize = sizeof(double);
+            break;
+
+        case LDouble:
+            typeSize = dataSize = sizeof(long double);
+            break;
+
+        case String:
+            typeSize = sizeof(char);
+            dataSize = strlen(data) + 1;
+            break;
+
+        case Var:
+            typeSize = dataSize = sizeof(Dynvar);
+            break;
+
+        default:
+            fprintf(stderr, "Error: this data type is not supported.\n");
+            return NULL;
+    }
+
+    // Small data is stored in a pooled element, large data past the end of its own element
+    if (dataSize <= DYNLST_INLINE_SIZE)
+        element = __Dynlst_AllocElem(header);
+    else
+        element = malloc(offsetof(struct __DynlstElem, Inline) + dataSize);
+
+    if (!element)
+    {
+        fprintf(stderr, "Error: failed to allocate memory for a new list element.\n");
+        return NULL;
+    }
+
+    element->Data = element->Inline;
+    element->Type = DType;
+    element->TypeSize = typeSize;
+    element->DataSize = dataSize;
+
+    if (DType == Var)
+    {
+        copy = DynvarCopy(data);
+        memcpy(element->Data, &copy, sizeof(Dynvar));
+        element->DataSize += copy.Size;
+    }
+    else
+        memcpy(element->Data, data, dataSize);
+
+    // These pointers should be properly initialized after this call is returned
+    element->Next = NULL;
+    element->Prev = NULL;
+
+    return element;
+}
+
+/** \brief Takes a list element from the slabs of a linked list.
+ * \remark Elements that were released are reused first. Otherwise, the element is taken from the most
+ * recent slab, and a new slab is allocated when it's full.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \retval struct __DynlstElem*
+ * \arg If successful, returns a pointer to an uninitialized list element.
+ * \arg Otherwise, returns NULL.
+ */
+static struct __DynlstElem* __Dynlst_AllocElem (struct DynlstHeader* header)
+{
+    struct __DynlstElem* element = header->Spare;
+    struct __DynlstSlab* slab = header->Slabs;
+    unsigned int capacity;
+
+    // Reuse a released element
+    if (element)
+    {
+        header->Spare = element->Next;
+        return element;
+    }
+
+    // Allocate a new slab, twice as large as the previous one
+    if (!slab || slab->Used == slab->Capacity)
+    {
+        capacity = (slab) ? slab->Capacity * 2 : __DYNLST_FIRST_SLAB;
+
+        if (capacity > DYNLST_SLAB_SIZE)
+            capacity = DYNLST_SLAB_SIZE;
+
+        if (capacity < 1)
+            capacity = 1;
+
+        slab = malloc(sizeof(struct __DynlstSlab) + capacity * sizeof(struct __DynlstElem));
+
+        if (!slab)
+            return NULL;
+
+        slab->Next = header->Slabs;
+        slab->Capacity = capacity;
+        slab->Used = 0;
+        header->Slabs = slab;
+    }
+
+    return &slab->Elems[slab->Used++];
+}
+
+/** \brief Links a new element to a linked list and accounts for it in the header.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \param[in] element The new list element.
+ * \param[in] next The list element the new element is linked before, or NULL to link it at the end of the list.
+ * \param[in] index The index of the new element.
+ * \return \c void
+ */
+static void __Dynlst_Link (struct DynlstHeader* header, struct __DynlstElem* element, struct __DynlstElem* next, int index)
+{
+    element->Next = next;
+    element->Prev = (next) ? next->Prev : header->Last;
+
+    // Link the surrounding elements to the new element
+    if (element->Prev)
+        element->Prev->Next = element;
+    else
+        header->First = element;
+
+    if (next)
+        next->Prev = element;
+    else
+        header->Last = element;
+
+    header->Count++;                                                // Update header count
+    header->Size += element->DataSize;                              // Update amount of bytes allocated for the data stored in the list
+    header->TotalSize += element->DataSize + sizeof(__DynlstElem);  // Update total amount of bytes in the list (data + objects)
+
+    if (header->Index)
+        __Dynlst_IndexInsert(header->Index, element, index);
+}
+
+/** \brief Unlinks an element from a linked list, updates the header and deallocates the element.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \param[in] element The list element to be removed.
+ * \param[in] index The index of the list element.
+ * \return \c void
+ */
+static void __Dynlst_Unlink (struct DynlstHeader* header, struct __DynlstElem* element, int index)
+{
+    if (header->Index)
+        __Dynlst_IndexRemove(header->Index, index);
+
+    // Link the surrounding elements to each other
+    if (element->Prev)
+        element->Prev->Next = element->Next;
+    else
+        header->First = element->Next;
+
+    if (element->Next)
+        element->Next->Prev = element->Prev;
+    else
+        header->Last = element->Prev;
+
+    // Update header
+    header->Count--;
+    header->Size -= element->DataSize;
+    header->TotalSize -= element->DataSize + sizeof(__DynlstElem);
+
+    // Nuke the element
+    __Dynlst_ClearElem(header, element);
+}
+
+/** \brief Allocates a tower of a random height for the index of a DynamicList.
+ * \remark Each level is reached with a probability of 1/4, so about a quarter of the list elements get a tower.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] index The index of the linked list.
+ * \param[in] element The list element the tower points to.
+ * \param[out] height Receives the amount of levels of the tower.
+ * \retval struct __DynlstTower*
+ * \arg Returns a pointer to the tower, whose levels are not initialized.
+ * \arg Returns NULL if the element gets no tower, or if the allocation failed.
+ */
+static struct __DynlstTower* __Dynlst_NewTower (struct __DynlstIndex* index, struct __DynlstElem* element, unsigned int* height)
+{
+    struct __DynlstTower* tower;
+    unsigned int random = index->Seed;
+
+    // Xorshift generator
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    index->Seed = random;
+
+    // Every two zero bits add a level
+    for (*height = 0; (random & 3) == 0 && *height < __DYNLST_INDEX_LEVELS; random >>= 2)
+        (*height)++;
+
+    if (*height == 0)
+        return NULL;
+
+    tower = malloc(sizeof(struct __DynlstTower) + *height * sizeof(struct __DynlstLevel));
+
+    if (tower)
+        tower->Element = element;
+
+    return tower;
+}
+
+/** \brief Finds the last tower before an index position at each level of the index of a DynamicList.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] index The index of the linked list.
+ * \param[in] position The index position.
+ * \param[out] path Receives a pointer to the level of the tower found at each level.
+ * \param[out] ranks Receives the index position of the tower found at each level.
+ * \return \c void
+ */
+static void __Dynlst_IndexPath (struct __DynlstIndex* index, int position, struct __DynlstLevel** path, int* ranks)
+{
+    struct __DynlstLevel* levels = index->Head;
+    int rank = -1;
+
+    for (int level = __DYNLST_INDEX_LEVELS - 1; level >= 0; level--)
+    {
+        while (levels[level].Next && rank + (int)levels[level].Span < position)
+        {
+            rank += levels[level].Span;
+            levels = levels[level].Next->Levels;
+        }
+
+        path[level] = &levels[level];
+        ranks[level] = rank;
+    }
+}
+
+/** \brief Updates the index of a DynamicList after a list element was added.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] index The index of the linked list.
+ * \param[in] element The list element that was added.
+ * \param[in] position The index position of the list element.
+ * \return \c void
+ */
+static void __Dynlst_IndexInsert (struct __DynlstIndex* index, struct __DynlstElem* element, int position)
+{
+    struct __DynlstLevel* path[__DYNLST_INDEX_LEVELS];
+    int ranks[__DYNLST_INDEX_LEVELS];
+    unsigned int height;
+    struct __DynlstTower* tower = __Dynlst_NewTower(index, element, &height);
+
+    // If the element gets no tower, it's only counted by the levels above it
+    if (!tower)
+        height = 0;
+
+    __Dynlst_IndexPath(index, position, path, ranks);
+
+    for (unsigned int level = 0; level < __DYNLST_INDEX_LEVELS; level++)
+    {
+        if (level < height)
+        {
+            tower->Levels[level].Next = path[level]->Next;
+            tower->Levels[level].Span = path[level]->Span - (position - ranks[level]) + 1;
+            path[level]->Next = tower;
+            path[level]->Span = position - ranks[level];
+        }
+        else
+            path[level]->Span++;
+    }
+}
+
+/** \brief Updates the index of a DynamicList before a list element is removed.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] index The index of the linked list.
+ * \param[in] position The index position of the list element.
+ * \return \c void
+ */
+static void __Dynlst_IndexRemove (struct __DynlstIndex* index, int position)
+{
+    struct __DynlstLevel* path[__DYNLST_INDEX_LEVELS];
+    int ranks[__DYNLST_INDEX_LEVELS];
+    struct __DynlstTower* tower = NULL;
+    struct __DynlstTower* next;
+
+    __Dynlst_IndexPath(index, position, path, ranks);
+
+    for (int level = 0; level < __DYNLST_INDEX_LEVELS; level++)
+    {
+        next = path[level]->Next;
+
+        // Skip over the tower of the element, if it reaches this level
+        if (next && ranks[level] + (int)path[level]->Span == position)
+        {
+            path[level]->Span += next->Levels[level].Span - 1;
+            path[level]->Next = next->Levels[level].Next;
+            tower = next;
+        }
+        else
+            path[level]->Span--;
+    }
+
+    free(tower);
+}
+
+/** \brief Points the towers of the index of a DynamicList to the list elements at their index positions.
+ * \remark The towers keep their positions, so the index stays balanced after the list is reordered.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \return \c void
+ */
+static void __Dynlst_IndexRelink (struct DynlstHeader* header)
+{
+    struct __DynlstElem* element = NULL;
+    struct __DynlstTower* tower = header->Index->Head[0].Next;
+    unsigned int span = header->Index->Head[0].Span;
+
+    for (; tower; span = tower->Levels[0].Span, tower = tower->Levels[0].Next)
+    {
+        // Walk to the element at the position of the tower
+        for (; span > 0; span--)
+            element = (element) ? element->Next : header->First;
+
+        tower->Element = element;
+    }
+}
+
+/** \brief Sorts a linked list with a bottom-up merge sort.
+ * \details Sorted runs of doubling length are merged until the whole list is one run. The elements are only
+ * relinked, and an element of the left run is taken first when both compare equal, so the sort is stable.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \param[in] compar Pointer to the function that compares two list elements.
+ * \param[in] descending Non-zero to sort in the order opposite to <i>compar</i>.
+ * \return \c void
+ */
+static void __Dynlst_Sort (struct DynlstHeader* header, int (*compar)(const struct __DynlstElem*, const struct __DynlstElem*), int descending)
+{
+    struct __DynlstElem* list = header->First;
+    struct __DynlstElem *left, *right, *next, *tail;
+    unsigned int leftSize, rightSize, merges;
+    int order;
+
+    if (header->Count < 2)
+        return;
+
+    for (unsigned int runSize = 1; ; runSize *= 2)
+    {
+        left = list;
+        list = NULL;
+        tail = NULL;
+        merges = 0;
+
+        while (left)
+        {
+            merges++;
+
+            // The right run starts after the left run
+            right = left;
+
+            for (leftSize = 0; leftSize < runSize && right; leftSize++)
+                right = right->Next;
+
+            rightSize = runSize;
+
+            // Merge both runs into the output
+            while (leftSize > 0 || (rightSize > 0 && right))
+            {
+                if (leftSize == 0 || rightSize == 0 || !right)
+                    order = (leftSize == 0) ? 1 : -1;
+                else
+                {
+                    order = compar(left, right);
+
+                    if (descending)
+                        order = -order;
+                }
+
+                if (order <= 0)
+                {
+                    next = left;
+                    left = left->Next;
+                    leftSize--;
+                }
+                else
+                {
+                    next = right;
+                    right = right->Next;
+                    rightSize--;
+                }
+
+                if (tail)
+                    tail->Next = next;
+                else
+                    list = next;
+
+                next->Prev = tail;
+                tail = next;
+            }
+
+            left = right;
+        }
+
+        tail->Next = NULL;
+
+        // Stop once a single run was left to merge
+        if (merges <= 1)
+            break;
+    }
+
+    header->First = list;
+    header->Last = tail;
+
+    if (header->Index)
+        __Dynlst_IndexRelink(header);
+}
+
+/** \brief Compares two list elements. Used by DynlstSort() and DynlstSortDesc().
+ * \remark Elements that store data of different types are ordered by type. Otherwise, they are ordered by value.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] first Pointer to the first list element.
+ * \param[in] second Pointer to the second list element.
+ * \retval int
+ * \arg Returns a negative number if the first element should be placed before the second one.
+ * \arg Returns zero if both elements are equal.
+ * \arg Returns a positive number if the first element should be placed after the second one.
+ */
+static int __Dynlst_CompareElem (const struct __DynlstElem* first, const struct __DynlstElem* second)
+{
+    const struct DynamicVariable* firstVar = first->Data;
+    const struct DynamicVariable* secondVar = second->Data;
+
+    // If they don't store data of the same type, sort by type
+    if (first->Type != second->Type)
+        return (first->Type > second->Type) - (first->Type < second->Type);
+
+    if (first->Type != Var)
+        return __Dynlst_CompareByType(first->Data, second->Data, first->Type, first->DataSize);
+
+    // Dynamic variables are sorted by the type of their data, then by value
+    if (firstVar->Type != secondVar->Type)
+        return (firstVar->Type > secondVar->Type) - (firstVar->Type < secondVar->Type);
+
+    return __Dynlst_CompareByType(firstVar->Data, secondVar->Data, firstVar->Type, (firstVar->Size < secondVar->Size) ? firstVar->Size : secondVar->Size);
+}
+
+/** \brief Compares two values of the specified data type.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] first Pointer to the first value.
+ * \param[in] second Pointer to the second value.
+ * \param[in] DType The data type of both values.
+ * \param[in] size The size of the values, in bytes. Only used for custom data.
+ * \retval int
+ * \arg Returns a negative number if the first value is less than the second value.
+ * \arg Returns 0 if both values are equal.
+ * \arg Returns a positive number if the first value is greater than the second value.
+ */
+static int __Dynlst_CompareByType (const void* first, const void* second, enum DataType DType, size_t size)
+{
+    #define __DYNLST_THREE_WAY(T) return (*(const T*)first > *(const T*)second) - (*(const T*)first < *(const T*)second)
+
+    switch (DType)
+    {
+        case Char:      __DYNLST_THREE_WAY(signed char);
+        case Short:     __DYNLST_THREE_WAY(short);
+        case Int:       __DYNLST_THREE_WAY(int);
+        case Long:      __DYNLST_THREE_WAY(long);
+        case LLong:     __DYNLST_THREE_WAY(long long);
+        case UChar:     __DYNLST_THREE_WAY(unsigned char);
+        case UShort:    __DYNLST_THREE_WAY(unsigned short);
+        case UInt:      __DYNLST_THREE_WAY(unsigned int);
+        case ULong:     __DYNLST_THREE_WAY(unsigned long);
+        case ULLong:    __DYNLST_THREE_WAY(unsigned long long);
+        case Float:     __DYNLST_THREE_WAY(float);
+        case Double:    __DYNLST_THREE_WAY(double);
+        case LDouble:   __DYNLST_THREE_WAY(long double);
+        case String:    return strcmp(first, second);
+        default:        return memcmp(first, second, size);
+    }
+
+    #undef __DYNLST_THREE_WAY
+}
+
+/** \brief Deallocates a list element and the data stored in it.
+ * \remark Pooled elements are kept by the list to be reused.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \param[in] element The list element to be deallocated.
+ * \return \c void
+ */
+static void __Dynlst_ClearElem (struct DynlstHeader* header, struct __DynlstElem* element)
+{
+    if (element->Type == Var)
+        DynvarClear(element->Data);
+
+    if (__DYNLST_POOLED(element))
+    {
+        element->Next = header->Spare;
+        header->Spare = element;
+    }
+    else
+        free(element);
+}
+
+/** \brief Returns a pointer to the list element at the specified index.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] header The header of the linked list.
+ * \remark It uses the index of the list, if it has one. Otherwise, it walks the list from its nearest end.
+ * \param[in] index The index to fetch the list element from.
+ * \retval struct __DynlstElem*
+ * \arg Returns a pointer to the list element.
+ */
+static struct __DynlstElem* __Dynlst_GetElem (struct DynlstHeader* header, int index)
+{
+    struct __DynlstElem* target;
+
+    if (header->Index && index != 0 && index != (int)header->Count - 1)
+    {
+        struct __DynlstLevel* levels = header->Index->Head;
+        int rank = -1;
+
+        target = header->First;
+
+        // Descend the index to the last tower at or before the index
+        for (int level = __DYNLST_INDEX_LEVELS - 1; level >= 0; level--)
+        {
+            while (levels[level].Next && rank + (int)levels[level].Span <= index)
+            {
+                rank += levels[level].Span;
+                target = levels[level].Next->Element;
+                levels = levels[level].Next->Levels;
+            }
+        }
+
+        if (rank < 0)
+            rank = 0;
+
+        // Walk the remaining elements
+        for (; rank != index; rank++)
+            target = target->Next;
+    }
+    else if (index <= (int)header->Count / 2)
+    {
+        // Start from the beginning
+        target = header->First;
+
+        for (int counter = 0; counter != index; counter++)
+            target = target->Next;
+    }
+    else
+    {
+        // Start from the end
+        target = header->Last;
+
+        for (int counter = header->Count - 1; counter != index; counter--)
+            target = target->Prev;
+    }
 
     return target;
 }
+
+/** \brief Returns the size of the data types that can be stored in a DynamicUnrolledList.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] DType The data type.
+ * \retval unsigned short
+ * \arg Returns the size of the type, in bytes, or zero if the type is not supported.
+ */
+static unsigned short __Dynulst_SizeOf (enum DataType DType)
+{
+    switch (DType)
+    {
+        case Var:   return sizeof(struct DynamicVariable);
+        case Ptr:   return sizeof(void*);
+        default:    return __Dyn_SizeOf(DType);
+    }
+}
+
+/** \brief Allocates an empty node and links it to an unrolled list.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] list The unrolled list.
+ * \param[in] prev The node the new node is linked after, or NULL to link it at the beginning of the list.
+ * \retval struct __DynulstNode*
+ * \arg If successful, returns a pointer to the new node.
+ * \arg Otherwise, returns NULL and the list is left untouched.
+ */
+static struct __DynulstNode* __Dynulst_NewNode (struct DynamicUnrolledList* list, struct __DynulstNode* prev)
+{
+    struct __DynulstNode* node;
+
+    if (list->TypeSize == 0)
+    {
+        fprintf(stderr, "Error: the unrolled list has no data type.\n");
+        return NULL;
+    }
+
+    node = malloc(sizeof(struct __DynulstNode) + (size_t)list->NodeCapacity * list->TypeSize);
+
+    if (!node)
+    {
+        fprintf(stderr, "Error: failed to allocate memory for a new unrolled list node.\n");
+        return NULL;
+    }
+
+    node->Count = 0;
+    node->Prev = prev;
+    node->Next = (prev) ? prev->Next : list->First;
+
+    // Link the surrounding nodes to the new node
+    if (node->Next)
+        node->Next->Prev = node;
+    else
+        list->Last = node;
+
+    if (prev)
+        prev->Next = node;
+    else
+        list->First = node;
+
+    return node;
+}
+
+/** \brief Unlinks a node from an unrolled list and deallocates it. Its elements are not released.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] list The unrolled list.
+ * \param[in] node The node to be removed.
+ * \return \c void
+ */
+static void __Dynulst_FreeNode (struct DynamicUnrolledList* list, struct __DynulstNode* node)
+{
+    if (node->Prev)
+        node->Prev->Next = node->Next;
+    else
+        list->First = node->Next;
+
+    if (node->Next)
+        node->Next->Prev = node->Prev;
+    else
+        list->Last = node->Prev;
+
+    free(node);
+}
+
+/** \brief Finds the node that stores the element at the specified index.
+ * \remark The nodes are walked from the nearest end of the list.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] list The unrolled list.
+ * \param[in] index The index of the element. It must be in range.
+ * \param[out] offset Receives the position of the element inside the node.
+ * \retval struct __DynulstNode*
+ * \arg Returns a pointer to the node.
+ */
+static struct __DynulstNode* __Dynulst_Locate (struct DynamicUnrolledList* list, unsigned int index, unsigned int* offset)
+{
+    struct __DynulstNode* node;
+
+    if (index <= list->Count / 2)
+    {
+        // Start from the beginning
+        node = list->First;
+
+        while (index >= node->Count)
+        {
+            index -= node->Count;
+            node = node->Next;
+        }
+    }
+    else
+    {
+        // Start from the end
+        node = list->Last;
+        index = list->Count - 1 - index;
+
+        while (index >= node->Count)
+        {
+            index -= node->Count;
+            node = node->Prev;
+        }
+
+        index = node->Count - 1 - index;
+    }
+
+    *offset = index;
+    return node;
+}
+
+/** \brief Copies an element into a slot of an unrolled list. Dynamic variables are deep copied.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] list The unrolled list.
+ * \param[out] target Pointer to the slot.
+ * \param[in] data Pointer to the element.
+ * \return \c void
+ */
+static void __Dynulst_CopyIn (struct DynamicUnrolledList* list, void* target, void* data)
+{
+    if (list->Type == Var)
+    {
+        struct DynamicVariable copy = DynvarCopy(data);
+        memcpy(target, &copy, sizeof(copy));
+    }
+    else
+        memcpy(target, data, list->TypeSize);
+}
+
+/** \brief Inserts an element into a node of an unrolled list.
+ * \remark If the node is full, the upper half of its elements is moved to a new node first.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] list The unrolled list.
+ * \param[in] node The node to insert the element into.
+ * \param[in] offset The position of the element inside the node.
+ * \param[in] data Pointer to the element.
+ * \return \c void
+ */
+static void __Dynulst_Insert (struct DynamicUnrolledList* list, struct __DynulstNode* node, unsigned int offset, void* data)
+{
+    // Split the node
+    if (node->Count == list->NodeCapacity)
+    {
+        struct __DynulstNode* next = __Dynulst_NewNode(list, node);
+        unsigned int half = node->Count / 2;
+
+        if (!next)
+            return;
+
+        next->Count = node->Count - half;
+        node->Count = half;
+        memcpy(next->Data, __DYNULST_ELEM(list, node, half), (size_t)next->Count * list->TypeSize);
+
+        if (offset > half)
+        {
+            offset -= half;
+            node = next;
+        }
+    }
+
+    // Open a slot for the element
+    memmove(
+        __DYNULST_ELEM(list, node, offset + 1),
+        __DYNULST_ELEM(list, node, offset),
+        (size_t)(node->Count - offset) * list->TypeSize
+    );
+
+    __Dynulst_CopyIn(list, __DYNULST_ELEM(list, node, offset), data);
+    node->Count++;
+    list->Count++;
+}
+
+/** \brief Removes an element from a node of an unrolled list.
+ * \remark A node left less than half full is merged with a neighbouring node, if their elements fit in one node.
+ * Empty nodes are deallocated.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] list The unrolled list.
+ * \param[in] node The node that stores the element.
+ * \param[in] offset The position of the element inside the node.
+ * \return \c void
+ */
+static void __Dynulst_Erase (struct DynamicUnrolledList* list, struct __DynulstNode* node, unsigned int offset)
+{
+    struct __DynulstNode* target;
+
+    if (list->Type == Var)
+        DynvarClear(__DYNULST_ELEM(list, node, offset));
+
+    memmove(
+        __DYNULST_ELEM(list, node, offset),
+        __DYNULST_ELEM(list, node, offset + 1),
+        (size_t)(node->Count - offset - 1) * list->TypeSize
+    );
+
+    node->Count--;
+    list->Count--;
+
+    if (node->Count == 0)
+    {
+        __Dynulst_FreeNode(list, node);
+        return;
+    }
+    else if (node->Count >= list->NodeCapacity / 2)
+        return;
+
+    // Merge the node into the previous one, or the next one into the node
+    if (node->Prev && node->Prev->Count + node->Count <= list->NodeCapacity)
+    {
+        target = node->Prev;
+    }
+    else if (node->Next && node->Next->Count + node->Count <= list->NodeCapacity)
+    {
+        target = node;
+        node = node->Next;
+    }
+    else
+        return;
+
+    memcpy(__DYNULST_ELEM(list, target, target->Count), node->Data, (size_t)node->Count * list->TypeSize);
+    target->Count += node->Count;
+    __Dynulst_FreeNode(list, node);
+}
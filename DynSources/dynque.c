@@ -0,0 +1,451 @@
+#include "../DynHeaders/dynque.h"
+#include "../DynHeaders/dynsize.h"
+
+#ifdef _WIN32
+    #include <malloc.h>     /* _aligned_malloc, _aligned_free */
+#endif // _WIN32
+
+
+/* Private Functions */
+
+
+static size_t __Dynque_SizeOf (enum DataType);
+static size_t __Dynque_Capacity (size_t);
+static void* __Dynque_Allocate (size_t);
+static void __Dynque_Free (void*);
+
+/** \brief Returns a pointer to the sequence number of the slot of a DynamicMpmcQueue for the specified index.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNQUE_SEQUENCE(squeue, index) ((size_t*)((squeue)->Slots + (((index) & ((squeue)->Capacity - 1)) * (squeue)->SlotSize)))
+
+/** \brief Returns a pointer to the element in the slot of a DynamicMpmcQueue for the specified index.
+ * \warning <u>This is a private macro and is not meant to be directly invoked!</u>
+ */
+#define __DYNQUE_ELEMENT(squeue, index) ((void*)(__DYNQUE_SEQUENCE(squeue, index) + 1))
+
+
+/* Public Functions */
+
+
+/** \brief Initializes an object of type DynamicSpscQueue according to the specified data type.
+ * \remark Only integer, floating-point and pointer types are supported.
+ * \param[in] capacity The amount of elements the queue should be able to store. It's rounded up to a power of 2.
+ * \param[in] DType The data type of the elements to be stored in the queue.
+ * \retval struct DynamicSpscQueue
+ * \arg If successful, the DynamicSpscQueue will contain a pointer to the allocated buffer.
+ * \arg Otherwise, the DynamicSpscQueue will contain a null pointer.
+ */
+struct DynamicSpscQueue NewDynamicSpscQueue (size_t capacity, enum DataType DType)
+{
+    struct DynamicSpscQueue squeue = { .Type = DType, .TypeSize = __Dynque_SizeOf(DType), .Capacity = __Dynque_Capacity(capacity) };
+
+    if (squeue.TypeSize == 0)
+    {
+        fprintf(stderr, "Error: unrecognized type. A null queue was generated.\n");
+        DynspscClear(&squeue);
+    }
+    else if (squeue.Capacity == 0 || squeue.Capacity > SIZE_MAX / squeue.TypeSize
+        || !(squeue.Array = __Dynque_Allocate(squeue.Capacity * squeue.TypeSize)))
+    {
+        fprintf(stderr, "Error: failed to allocate memory for the new queue.\n");
+        DynspscClear(&squeue);
+    }
+
+    return squeue;
+}
+
+/** \brief Adds an element to the end of a DynamicSpscQueue.
+ * \warning Only one thread may add elements to the queue at a time.
+ * \param[out] squeue Pointer to a DynamicSpscQueue.
+ * \param[in] newElement Pointer to the element to be added.
+ * \retval int
+ * \arg If the queue wasn't full, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynspscPush (struct DynamicSpscQueue* squeue, const void* newElement)
+{
+    return DynspscPushBatch(squeue, newElement, 1) == 1;
+}
+
+/** \brief Removes the first element of a DynamicSpscQueue.
+ * \warning Only one thread may remove elements from the queue at a time.
+ * \param[out] squeue Pointer to a DynamicSpscQueue.
+ * \param[out] output Pointer to the memory that will receive the removed element.
+ * \retval int
+ * \arg If the queue wasn't empty, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynspscPop (struct DynamicSpscQueue* squeue, void* output)
+{
+    return DynspscPopBatch(squeue, output, 1) == 1;
+}
+
+/** \brief Adds as many elements as possible to the end of a DynamicSpscQueue.
+ * \details The elements are copied in at most two blocks and published to the consumer all at once.
+ * \warning Only one thread may add elements to the queue at a time.
+ * \param[out] squeue Pointer to a DynamicSpscQueue.
+ * \param[in] source Pointer to an array with the elements to be added.
+ * \param[in] amount The amount of elements to be added.
+ * \retval size_t
+ * \arg Returns the amount of elements added, which is smaller than <i>amount</i> if the queue filled up.
+ */
+size_t DynspscPushBatch (struct DynamicSpscQueue* squeue, const void* source, size_t amount)
+{
+    size_t tail = squeue->Tail;
+    size_t slot = tail & (squeue->Capacity - 1);
+    size_t space = squeue->Capacity - (tail - squeue->CachedHead);
+    size_t first;
+
+    // Only look at the index of the consumer when the cached one says there's not enough space
+    if (space < amount)
+    {
+        squeue->CachedHead = __atomic_load_n(&squeue->Head, __ATOMIC_ACQUIRE);
+        space = squeue->Capacity - (tail - squeue->CachedHead);
+    }
+
+    if (amount > space)
+        amount = space;
+
+    if (amount == 0)
+        return 0;
+
+    first = (amount < squeue->Capacity - slot) ? amount : squeue->Capacity - slot;
+    memcpy(squeue->Array + (slot * squeue->TypeSize), source, first * squeue->TypeSize);
+    memcpy(squeue->Array, source + (first * squeue->TypeSize), (amount - first) * squeue->TypeSize);
+
+    __atomic_store_n(&squeue->Tail, tail + amount, __ATOMIC_RELEASE);
+
+    return amount;
+}
+
+/** \brief Removes as many elements as possible from the beginning of a DynamicSpscQueue.
+ * \details The elements are copied in at most two blocks and handed back to the producer all at once.
+ * \warning Only one thread may remove elements from the queue at a time.
+ * \param[out] squeue Pointer to a DynamicSpscQueue.
+ * \param[out] target Pointer to an array that will receive the removed elements, in order.
+ * \param[in] amount The amount of elements to be removed.
+ * \retval size_t
+ * \arg Returns the amount of elements removed, which is smaller than <i>amount</i> if the queue ran out of elements.
+ */
+size_t DynspscPopBatch (struct DynamicSpscQueue* squeue, void* target, size_t amount)
+{
+    size_t head = squeue->Head;
+    size_t slot = head & (squeue->Capacity - 1);
+    size_t available = squeue->CachedTail - head;
+    size_t first;
+
+    // Only look at the index of the producer when the cached one says there aren't enough elements
+    if (available < amount)
+    {
+        squeue->CachedTail = __atomic_load_n(&squeue->Tail, __ATOMIC_ACQUIRE);
+        available = squeue->CachedTail - head;
+    }
+
+    if (amount > available)
+        amount = available;
+
+    if (amount == 0)
+        return 0;
+
+    first = (amount < squeue->Capacity - slot) ? amount : squeue->Capacity - slot;
+    memcpy(target, squeue->Array + (slot * squeue->TypeSize), first * squeue->TypeSize);
+    memcpy(target + (first * squeue->TypeSize), squeue->Array, (amount - first) * squeue->TypeSize);
+
+    __atomic_store_n(&squeue->Head, head + amount, __ATOMIC_RELEASE);
+
+    return amount;
+}
+
+/** \brief Returns the amount of elements stored in a DynamicSpscQueue.
+ * \remark The result may be outdated by the time it's returned, if the queue is being used by other threads.
+ * \param[in] squeue Pointer to a DynamicSpscQueue.
+ * \retval size_t
+ * \arg Returns the amount of elements in the queue.
+ */
+size_t DynspscCount (struct DynamicSpscQueue* squeue)
+{
+    size_t head = __atomic_load_n(&squeue->Head, __ATOMIC_ACQUIRE);
+
+    return __atomic_load_n(&squeue->Tail, __ATOMIC_ACQUIRE) - head;
+}
+
+/** \brief Deallocates the memory of a DynamicSpscQueue and resets all its properties.
+ * \warning No other thread may be using the queue.
+ * \param[out] squeue Pointer to a DynamicSpscQueue.
+ * \return \c void
+ */
+void DynspscClear (struct DynamicSpscQueue* squeue)
+{
+    __Dynque_Free(squeue->Array);
+
+    // Reset everything
+    squeue->Array = NULL;
+    squeue->Head = squeue->CachedTail = 0;
+    squeue->Tail = squeue->CachedHead = 0;
+    squeue->Capacity = 0;
+    squeue->TypeSize = 0;
+    squeue->Type = 0;
+}
+
+/** \brief Initializes an object of type DynamicMpmcQueue according to the specified data type.
+ * \remark Only integer, floating-point and pointer types are supported.
+ * \param[in] capacity The amount of elements the queue should be able to store. It's rounded up to a power of 2.
+ * \param[in] DType The data type of the elements to be stored in the queue.
+ * \retval struct DynamicMpmcQueue
+ * \arg If successful, the DynamicMpmcQueue will contain a pointer to the allocated buffer.
+ * \arg Otherwise, the DynamicMpmcQueue will contain a null pointer.
+ */
+struct DynamicMpmcQueue NewDynamicMpmcQueue (size_t capacity, enum DataType DType)
+{
+    struct DynamicMpmcQueue squeue = { .Type = DType, .TypeSize = __Dynque_SizeOf(DType), .Capacity = __Dynque_Capacity(capacity) };
+
+    // Each slot starts with its sequence number, so it must stay aligned for it
+    squeue.SlotSize = (sizeof(size_t) + squeue.TypeSize + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1);
+
+    if (squeue.TypeSize == 0)
+    {
+        fprintf(stderr, "Error: unrecognized type. A null queue was generated.\n");
+        DynmpmcClear(&squeue);
+        return squeue;
+    }
+    else if (squeue.Capacity == 0 || squeue.Capacity > SIZE_MAX / squeue.SlotSize
+        || !(squeue.Slots = __Dynque_Allocate(squeue.Capacity * squeue.SlotSize)))
+    {
+        fprintf(stderr, "Error: failed to allocate memory for the new queue.\n");
+        DynmpmcClear(&squeue);
+        return squeue;
+    }
+
+    // A slot is ready to be written when its sequence number matches the index that claims it
+    for (size_t counter = 0; counter < squeue.Capacity; counter++)
+        *__DYNQUE_SEQUENCE(&squeue, counter) = counter;
+
+    return squeue;
+}
+
+/** \brief Adds an element to the end of a DynamicMpmcQueue.
+ * \param[out] squeue Pointer to a DynamicMpmcQueue.
+ * \param[in] newElement Pointer to the element to be added.
+ * \retval int
+ * \arg If the queue wasn't full, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynmpmcPush (struct DynamicMpmcQueue* squeue, const void* newElement)
+{
+    return DynmpmcPushBatch(squeue, newElement, 1) == 1;
+}
+
+/** \brief Removes the first element of a DynamicMpmcQueue.
+ * \param[out] squeue Pointer to a DynamicMpmcQueue.
+ * \param[out] output Pointer to the memory that will receive the removed element.
+ * \retval int
+ * \arg If the queue wasn't empty, returns non-zero.
+ * \arg Otherwise, returns zero.
+ */
+int DynmpmcPop (struct DynamicMpmcQueue* squeue, void* output)
+{
+    return DynmpmcPopBatch(squeue, output, 1) == 1;
+}
+
+/** \brief Adds as many elements as possible to the end of a DynamicMpmcQueue.
+ * \details The producer counts how many consecutive slots are ready to be written and claims all of them
+ * with a single atomic operation. Elements added by one call are consecutive in the queue.
+ * \param[out] squeue Pointer to a DynamicMpmcQueue.
+ * \param[in] source Pointer to an array with the elements to be added.
+ * \param[in] amount The amount of elements to be added.
+ * \retval size_t
+ * \arg Returns the amount of elements added, which is smaller than <i>amount</i> if the queue filled up.
+ */
+size_t DynmpmcPushBatch (struct DynamicMpmcQueue* squeue, const void* source, size_t amount)
+{
+    size_t position = __atomic_load_n(&squeue->Tail, __ATOMIC_RELAXED);
+    size_t ready, counter;
+
+    if (amount > squeue->Capacity)
+        amount = squeue->Capacity;
+
+    while (1)
+    {
+        for (ready = 0; ready < amount && __atomic_load_n(__DYNQUE_SEQUENCE(squeue, position + ready), __ATOMIC_ACQUIRE) == position + ready; ready++);
+
+        if (ready == 0)
+        {
+            // The slot still holds an element from the previous lap, so the queue is full
+            if (amount == 0 || (ptrdiff_t)(__atomic_load_n(__DYNQUE_SEQUENCE(squeue, position), __ATOMIC_ACQUIRE) - position) < 0)
+                return 0;
+
+            // Another producer claimed the slot first
+            position = __atomic_load_n(&squeue->Tail, __ATOMIC_RELAXED);
+        }
+        else if (__atomic_compare_exchange_n(&squeue->Tail, &position, position + ready, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+
+    // Publish each element to the consumers as soon as it's written
+    for (counter = 0; counter < ready; counter++)
+    {
+        memcpy(__DYNQUE_ELEMENT(squeue, position + counter), source + (counter * squeue->TypeSize), squeue->TypeSize);
+        __atomic_store_n(__DYNQUE_SEQUENCE(squeue, position + counter), position + counter + 1, __ATOMIC_RELEASE);
+    }
+
+    return ready;
+}
+
+/** \brief Removes as many elements as possible from the beginning of a DynamicMpmcQueue.
+ * \details The consumer counts how many consecutive slots are ready to be read and claims all of them
+ * with a single atomic operation. Elements removed by one call were consecutive in the queue.
+ * \param[out] squeue Pointer to a DynamicMpmcQueue.
+ * \param[out] target Pointer to an array that will receive the removed elements, in order.
+ * \param[in] amount The amount of elements to be removed.
+ * \retval size_t
+ * \arg Returns the amount of elements removed, which is smaller than <i>amount</i> if the queue ran out of elements.
+ */
+size_t DynmpmcPopBatch (struct DynamicMpmcQueue* squeue, void* target, size_t amount)
+{
+    size_t position = __atomic_load_n(&squeue->Head, __ATOMIC_RELAXED);
+    size_t ready, counter;
+
+    if (amount > squeue->Capacity)
+        amount = squeue->Capacity;
+
+    while (1)
+    {
+        for (ready = 0; ready < amount && __atomic_load_n(__DYNQUE_SEQUENCE(squeue, position + ready), __ATOMIC_ACQUIRE) == position + ready + 1; ready++);
+
+        if (ready == 0)
+        {
+            // The slot hasn't been written in this lap yet, so the queue is empty
+            if (amount == 0 || (ptrdiff_t)(__atomic_load_n(__DYNQUE_SEQUENCE(squeue, position), __ATOMIC_ACQUIRE) - (position + 1)) < 0)
+                return 0;
+
+            // Another consumer claimed the slot first
+            position = __atomic_load_n(&squeue->Head, __ATOMIC_RELAXED);
+        }
+        else if (__atomic_compare_exchange_n(&squeue->Head, &position, position + ready, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+
+    // Hand each slot back to the producers of the next lap as soon as it's read
+    for (counter = 0; counter < ready; counter++)
+    {
+        memcpy(target + (counter * squeue->TypeSize), __DYNQUE_ELEMENT(squeue, position + counter), squeue->TypeSize);
+        __atomic_store_n(__DYNQUE_SEQUENCE(squeue, position + counter), position + counter + squeue->Capacity, __ATOMIC_RELEASE);
+    }
+
+    return ready;
+}
+
+/** \brief Returns the amount of elements stored in a DynamicMpmcQueue.
+ * \remark The result is only an estimate if the queue is being used by other threads. It includes elements
+ * that are still being written or read.
+ * \param[in] squeue Pointer to a DynamicMpmcQueue.
+ * \retval size_t
+ * \arg Returns the amount of elements in the queue.
+ */
+size_t DynmpmcCount (struct DynamicMpmcQueue* squeue)
+{
+    size_t head = __atomic_load_n(&squeue->Head, __ATOMIC_ACQUIRE);
+    size_t tail = __atomic_load_n(&squeue->Tail, __ATOMIC_ACQUIRE);
+
+    return (tail > head) ? tail - head : 0;
+}
+
+/** \brief Deallocates the memory of a DynamicMpmcQueue and resets all its properties.
+ * \warning No other thread may be using the queue.
+ * \param[out] squeue Pointer to a DynamicMpmcQueue.
+ * \return \c void
+ */
+void DynmpmcClear (struct DynamicMpmcQueue* squeue)
+{
+    __Dynque_Free(squeue->Slots);
+
+    // Reset everything
+    squeue->Slots = NULL;
+    squeue->Head = 0;
+    squeue->Tail = 0;
+    squeue->Capacity = 0;
+    squeue->SlotSize = 0;
+    squeue->TypeSize = 0;
+    squeue->Type = 0;
+}
+
+
+/* Support Functions */
+
+
+/** \brief Returns the size of the data types that can be stored in a queue.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] DType The data type.
+ * \retval size_t
+ * \arg Returns the size of the type, in bytes, or zero if the type is not supported.
+ */
+static size_t __Dynque_SizeOf (enum DataType DType)
+{
+    return (DType == Ptr) ? sizeof(void*) : __Dyn_SizeOf(DType);
+}
+
+/** \brief Rounds the capacity of a queue up to a power of 2.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] capacity The requested capacity. Zero for the default capacity.
+ * \retval size_t
+ * \arg Returns the capacity of the queue, or zero if it's too big.
+ */
+static size_t __Dynque_Capacity (size_t capacity)
+{
+    size_t rounded = 2;
+
+    // If capacity is invalid, set it to default
+    if (capacity == 0)
+        capacity = 1024;
+
+    while (rounded < capacity)
+    {
+        if (rounded > SIZE_MAX / 2)
+            return 0;
+
+        rounded *= 2;
+    }
+
+    return rounded;
+}
+
+/** \brief Allocates a buffer that starts at the beginning of a cache line.
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] bytes The size of the buffer, in bytes.
+ * \retval void*
+ * \arg If successful, returns a pointer to the buffer.
+ * \arg Otherwise, returns a null pointer.
+ */
+static void* __Dynque_Allocate (size_t bytes)
+{
+    // The size of an aligned buffer must be a multiple of its alignment
+    if (bytes > SIZE_MAX - DYNQUE_CACHE_LINE_SIZE)
+        return NULL;
+
+    bytes = (bytes + DYNQUE_CACHE_LINE_SIZE - 1) & ~((size_t)DYNQUE_CACHE_LINE_SIZE - 1);
+
+    #ifdef _WIN32
+        return _aligned_malloc(bytes, DYNQUE_CACHE_LINE_SIZE);
+    #else
+        return aligned_alloc(DYNQUE_CACHE_LINE_SIZE, bytes);
+    #endif // _WIN32
+}
+
+/** \brief Deallocates a buffer that was allocated by __Dynque_Allocate().
+ * \warning <u>This is a private function and is not meant to be directly invoked!</u>
+ * \param[in] buffer Pointer to the buffer. Can be NULL.
+ * \return \c void
+ */
+static void __Dynque_Free (void* buffer)
+{
+    #ifdef _WIN32
+        _aligned_free(buffer);
+    #else
+        free(buffer);
+    #endif // _WIN32
+}
@@ -40,7 +40,7 @@ int main()
     DynarrPrintAll(&secularArray, ", ");
 
     test = DynvarNewString(&test, "bippidy boppidy");
-    printf("\nIndexOf 5 = [%d]\n", DynarrIndexOf(&secularArray, &test));
+    printf("\nIndexOf 5 = [%d]\n", (int)DynarrIndexOf(&secularArray, &test));
 
     DynarrClear(&secularArray);
     DynvarClear(&test);